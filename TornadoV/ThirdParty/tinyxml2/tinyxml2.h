@@ -2,169 +2,555 @@
 #define TINYXML2_INCLUDED
 
 #include <string>
+#include <string_view>
 #include <vector>
-#include <map>
+#include <memory>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
 #include <fstream>
 #include <sstream>
 
+// Minimal tinyxml2-compatible reader/writer.
+// The file is loaded into one buffer and parsed in place: names and attribute
+// values are null-terminated slices of that buffer, and every node and
+// attribute array comes from a single bump arena owned by the document.
+// Loading a config is a handful of allocations regardless of its size.
+
 namespace tinyxml2 {
 
+enum XMLError {
+    XML_SUCCESS = 0,
+    XML_ERROR_FILE_NOT_FOUND,
+    XML_ERROR_PARSING
+};
+
+class XMLDocument;
+
+// Bump allocator; memory is only released all at once by Clear()
+class XMLArena {
+public:
+    void* Allocate(size_t size, size_t align = alignof(std::max_align_t)) {
+        size_t offset = (_used + align - 1) & ~(align - 1);
+        if (_blocks.empty() || offset + size > _blockSize) {
+            size_t blockSize = size > BLOCK_SIZE ? size : BLOCK_SIZE;
+            _blocks.emplace_back(new char[blockSize]);
+            _blockSize = blockSize;
+            offset = 0;
+        }
+        _used = offset + size;
+        return _blocks.back().get() + offset;
+    }
+
+    template<class T>
+    T* New() {
+        return new (Allocate(sizeof(T), alignof(T))) T();
+    }
+
+    char* CopyString(std::string_view text) {
+        char* out = (char*)Allocate(text.size() + 1, 1);
+        std::memcpy(out, text.data(), text.size());
+        out[text.size()] = '\0';
+        return out;
+    }
+
+    void Clear() {
+        _blocks.clear();
+        _blockSize = 0;
+        _used = 0;
+    }
+
+    size_t BlockCount() const { return _blocks.size(); }
+
+private:
+    static constexpr size_t BLOCK_SIZE = 16 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> _blocks;
+    size_t _blockSize = 0;
+    size_t _used = 0;
+};
+
+struct XMLAttribute {
+    std::string_view name;  // Null-terminated in storage
+    std::string_view value; // Null-terminated in storage
+    size_t valueCapacity;   // Bytes available at value.data() excluding the terminator
+};
+
+enum class XMLNodeKind {
+    Element,
+    Comment
+};
+
 class XMLElement {
 public:
-    const char* Name() const { return name.c_str(); }
+    const char* Name() const { return _name.data(); }
+    std::string_view NameView() const { return _name; }
+
+    // Trimmed, entity-decoded character data, or nullptr
+    const char* GetText() const { return _text.empty() ? nullptr : _text.data(); }
+    // Comment nodes only
+    const char* Value() const { return _text.data(); }
+    bool IsComment() const { return _kind == XMLNodeKind::Comment; }
+
     const char* Attribute(const char* attr) const {
-        auto it = attributes.find(attr);
-        return (it != attributes.end()) ? it->second.c_str() : nullptr;
+        const XMLAttribute* found = FindAttribute(attr);
+        return found ? found->value.data() : nullptr;
     }
-    XMLElement* FirstChildElement(const char* childName = nullptr) const {
-        for (auto child : children) {
-            if (!childName || child->name == childName) return child;
+
+    const XMLAttribute* FindAttribute(std::string_view attr) const {
+        for (int i = 0; i < _attrCount; i++) {
+            if (_attrs[i].name == attr) return &_attrs[i];
         }
         return nullptr;
     }
 
-    XMLElement* InsertNewChild(const char* childName) {
-        XMLElement* element = new XMLElement();
-        element->name = childName;
-        element->parent = this;
-        children.push_back(element);
-        return element;
+    int AttributeCount() const { return _attrCount; }
+    const XMLAttribute& AttributeAt(int index) const { return _attrs[index]; }
+
+    inline void SetAttribute(const char* attr, const char* value);
+    void SetAttribute(const char* attr, int value) { SetAttribute(attr, std::to_string(value).c_str()); }
+
+    XMLElement* FirstChildElement(const char* childName = nullptr) const {
+        return NextElement(_firstChild, childName);
     }
+
     XMLElement* NextSiblingElement(const char* siblingName = nullptr) const {
-        if (!parent) return nullptr;
-        bool foundSelf = false;
-        for (auto sibling : parent->children) {
-            if (foundSelf) {
-                if (!siblingName || sibling->name == siblingName) return sibling;
-            }
-            if (sibling == this) foundSelf = true;
+        return NextElement(_next, siblingName);
+    }
+
+    XMLElement* FirstChild() const { return _firstChild; }
+    XMLElement* NextSibling() const { return _next; }
+    XMLElement* Parent() const { return _parent; }
+
+    inline XMLElement* InsertNewChild(const char* childName);
+
+private:
+    friend class XMLDocument;
+
+    static uint32_t HashName(std::string_view name) {
+        uint32_t hash = 2166136261u;
+        for (char c : name) {
+            hash ^= (unsigned char)c;
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    // Compares the cached name hash first, so scanning siblings rarely touches the strings
+    static XMLElement* NextElement(XMLElement* node, const char* name) {
+        if (!name) {
+            while (node && node->_kind != XMLNodeKind::Element) node = node->_next;
+            return node;
+        }
+        std::string_view wanted(name);
+        uint32_t hash = HashName(wanted);
+        for (; node; node = node->_next) {
+            if (node->_kind == XMLNodeKind::Element && node->_nameHash == hash && node->_name == wanted) return node;
         }
         return nullptr;
     }
 
-    std::string name;
-    std::map<std::string, std::string> attributes;
-    std::vector<XMLElement*> children;
-    XMLElement* parent = nullptr;
+    void AppendChild(XMLElement* child) {
+        child->_parent = this;
+        if (_lastChild) _lastChild->_next = child;
+        else _firstChild = child;
+        _lastChild = child;
+    }
 
-    ~XMLElement() {
-        for (auto child : children) delete child;
+    XMLAttribute* AddAttribute(XMLArena& arena) {
+        if (_attrCount == _attrCapacity) {
+            int capacity = _attrCapacity ? _attrCapacity * 2 : 4;
+            XMLAttribute* grown = (XMLAttribute*)arena.Allocate(sizeof(XMLAttribute) * capacity, alignof(XMLAttribute));
+            for (int i = 0; i < _attrCount; i++) grown[i] = _attrs[i];
+            _attrs = grown;
+            _attrCapacity = capacity;
+        }
+        return &_attrs[_attrCount++];
     }
+
+    XMLDocument* _doc = nullptr;
+    XMLNodeKind _kind = XMLNodeKind::Element;
+    std::string_view _name;
+    uint32_t _nameHash = 0;
+    std::string_view _text;
+    XMLAttribute* _attrs = nullptr;
+    int _attrCount = 0;
+    int _attrCapacity = 0;
+    XMLElement* _parent = nullptr;
+    XMLElement* _firstChild = nullptr;
+    XMLElement* _lastChild = nullptr;
+    XMLElement* _next = nullptr;
 };
 
 class XMLDocument {
 public:
-    XMLElement* RootElement() const { return root; }
-    void LoadFile(const char* path) {
-        if (root) { delete root; root = nullptr; }
-        std::ifstream file(path);
-        if (!file.is_open()) return;
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        std::string content = buffer.str();
-        Parse(content);
+    XMLDocument() = default;
+    XMLDocument(const XMLDocument&) = delete;
+    XMLDocument& operator=(const XMLDocument&) = delete;
+
+    XMLElement* RootElement() const { return _root; }
+    bool Error() const { return _error != XML_SUCCESS; }
+    XMLArena& Arena() { return _arena; }
+
+    XMLError LoadFile(const char* path) {
+        Clear();
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) return _error = XML_ERROR_FILE_NOT_FOUND;
+
+        file.seekg(0, std::ios::end);
+        std::streamoff size = file.tellg();
+        file.seekg(0, std::ios::beg);
+        if (size < 0) return _error = XML_ERROR_FILE_NOT_FOUND;
+
+        _buffer.resize((size_t)size + 1);
+        file.read(_buffer.data(), size);
+        _buffer[(size_t)size] = '\0';
+        return _error = ParseBuffer();
+    }
+
+    XMLError Parse(const char* xml, size_t length) {
+        Clear();
+        _buffer.assign(xml, xml + length);
+        _buffer.push_back('\0');
+        return _error = ParseBuffer();
     }
 
-    void SaveFile(const char* path) {
-        if (!root) return;
-        std::ofstream file(path);
+    void SaveFile(const char* path) const {
+        if (!_root) return;
+        std::ofstream file(path, std::ios::binary);
         if (!file.is_open()) return;
-        file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-        Serialize(file, root, 0);
+        file << ToString();
     }
 
-    ~XMLDocument() { delete root; }
+    // Same text SaveFile writes, for callers that do their own file I/O
+    std::string ToString() const {
+        if (!_root) return "";
+        std::string out = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+        for (XMLElement* node = _top; node; node = node->_next) {
+            Serialize(out, node, 0);
+        }
+        return out;
+    }
+
+    void Clear() {
+        _arena.Clear();
+        _buffer.clear();
+        _root = nullptr;
+        _top = nullptr;
+        _error = XML_SUCCESS;
+    }
 
 private:
-    void Serialize(std::ostream& os, XMLElement* element, int indent) {
-        for (int i = 0; i < indent; ++i) os << "  ";
-        os << "<" << element->name;
-        for (auto const& [key, val] : element->attributes) {
-            os << " " << key << "=\"" << val << "\"";
-        }
-        if (element->children.empty()) {
-            os << " />\n";
+    friend class XMLElement;
+
+    static bool IsSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+    static bool IsNameEnd(char c) { return c == '\0' || IsSpace(c) || c == '/' || c == '>' || c == '='; }
+
+    static void AppendUtf8(char*& out, uint32_t cp) {
+        if (cp < 0x80) {
+            *out++ = (char)cp;
+        } else if (cp < 0x800) {
+            *out++ = (char)(0xC0 | (cp >> 6));
+            *out++ = (char)(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            *out++ = (char)(0xE0 | (cp >> 12));
+            *out++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+            *out++ = (char)(0x80 | (cp & 0x3F));
         } else {
-            os << ">\n";
-            for (auto child : element->children) {
-                Serialize(os, child, indent + 1);
+            *out++ = (char)(0xF0 | (cp >> 18));
+            *out++ = (char)(0x80 | ((cp >> 12) & 0x3F));
+            *out++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+            *out++ = (char)(0x80 | (cp & 0x3F));
+        }
+    }
+
+    // Decodes entities in [begin, end) in place; the result is never longer than the input
+    static size_t DecodeInPlace(char* begin, char* end) {
+        char* out = begin;
+        for (char* p = begin; p < end;) {
+            if (*p != '&') {
+                *out++ = *p++;
+                continue;
+            }
+            char* semi = p + 1;
+            while (semi < end && *semi != ';' && semi - p < 12) semi++;
+            std::string_view entity(p + 1, semi < end && *semi == ';' ? semi - p - 1 : 0);
+
+            if (entity == "lt") *out++ = '<';
+            else if (entity == "gt") *out++ = '>';
+            else if (entity == "amp") *out++ = '&';
+            else if (entity == "quot") *out++ = '"';
+            else if (entity == "apos") *out++ = '\'';
+            else if (entity.size() > 1 && entity[0] == '#') {
+                uint32_t cp = (uint32_t)std::strtoul(std::string(entity.substr(entity[1] == 'x' ? 2 : 1)).c_str(), nullptr, entity[1] == 'x' ? 16 : 10);
+                AppendUtf8(out, (cp == 0 || cp > 0x10FFFF) ? 0xFFFD : cp);
+            } else {
+                *out++ = *p++; // Not an entity we know; keep the '&' literally
+                continue;
             }
-            for (int i = 0; i < indent; ++i) os << "  ";
-            os << "</" << element->name << ">\n";
+            p = semi + 1;
+        }
+        *out = '\0';
+        return out - begin;
+    }
+
+    static void Escape(std::string& out, std::string_view text, bool attribute) {
+        for (char c : text) {
+            switch (c) {
+            case '&': out += "&amp;"; break;
+            case '<': out += "&lt;"; break;
+            case '>': out += "&gt;"; break;
+            case '"':
+                if (attribute) out += "&quot;";
+                else out += c;
+                break;
+            default: out += c; break;
+            }
+        }
+    }
+
+    XMLElement* NewNode(XMLNodeKind kind) {
+        XMLElement* node = _arena.New<XMLElement>();
+        node->_doc = this;
+        node->_kind = kind;
+        return node;
+    }
+
+    void AppendTopLevel(XMLElement* node) {
+        if (!_top) {
+            _top = node;
+        } else {
+            XMLElement* last = _top;
+            while (last->_next) last = last->_next;
+            last->_next = node;
         }
     }
 
-    void Parse(const std::string& xml) {
-        size_t pos = 0;
+    XMLError ParseBuffer() {
+        char* p = _buffer.data();
+        if (std::strncmp(p, "\xEF\xBB\xBF", 3) == 0) p += 3;
+
         XMLElement* current = nullptr;
-        
-        while (pos < xml.size()) {
-            pos = xml.find('<', pos);
-            if (pos == std::string::npos) break;
-            
-            if (xml[pos + 1] == '?' || xml[pos + 1] == '!') { // Skip <?xml...?> or <!--...-->
-                pos = xml.find('>', pos) + 1;
+        while (*p) {
+            char* lt = std::strchr(p, '<');
+            if (!lt) break;
+
+            // Character data before the tag belongs to the open element
+            if (current && lt > p) {
+                char* start = p;
+                char* end = lt;
+                while (start < end && IsSpace(*start)) start++;
+                while (end > start && IsSpace(end[-1])) end--;
+                if (start < end && current->_text.empty()) {
+                    char* text = _arena.CopyString(std::string_view(start, end - start));
+                    size_t length = DecodeInPlace(text, text + (end - start));
+                    current->_text = std::string_view(text, length);
+                }
+            }
+            p = lt;
+
+            if (std::strncmp(p, "<!--", 4) == 0) {
+                char* end = std::strstr(p + 4, "-->");
+                if (!end) return XML_ERROR_PARSING;
+                *end = '\0';
+                XMLElement* comment = NewNode(XMLNodeKind::Comment);
+                comment->_text = std::string_view(p + 4, end - (p + 4));
+                if (current) current->AppendChild(comment);
+                else AppendTopLevel(comment);
+                p = end + 3;
                 continue;
             }
 
-            if (xml[pos + 1] == '/') { // Closing tag
-                if (current) current = current->parent;
-                pos = xml.find('>', pos) + 1;
+            if (std::strncmp(p, "<![CDATA[", 9) == 0) {
+                char* end = std::strstr(p + 9, "]]>");
+                if (!end) return XML_ERROR_PARSING;
+                if (current && current->_text.empty()) {
+                    current->_text = std::string_view(_arena.CopyString(std::string_view(p + 9, end - (p + 9))), end - (p + 9));
+                }
+                p = end + 3;
                 continue;
             }
 
-            // Opening tag
-            size_t end = xml.find('>', pos);
-            if (end == std::string::npos) break;
-
-            bool selfClosing = (xml[end - 1] == '/');
-            std::string tagContent = xml.substr(pos + 1, end - pos - (selfClosing ? 2 : 1));
-            
-            size_t spacePos = tagContent.find(' ');
-            std::string tagName = tagContent.substr(0, spacePos);
-            
-            XMLElement* element = new XMLElement();
-            element->name = tagName;
-            element->parent = current;
-
-            // Parse attributes
-            if (spacePos != std::string::npos) {
-                std::string attrStr = tagContent.substr(spacePos + 1);
-                size_t attrPos = 0;
-                while (attrPos < attrStr.size()) {
-                    size_t eqPos = attrStr.find('=', attrPos);
-                    if (eqPos == std::string::npos) break;
-                    
-                    std::string key = attrStr.substr(attrPos, eqPos - attrPos);
-                    while (!key.empty() && isspace(key[0])) key.erase(0, 1);
-                    while (!key.empty() && isspace(key.back())) key.pop_back();
-
-                    size_t quoteStart = attrStr.find('"', eqPos);
-                    if (quoteStart == std::string::npos) break;
-                    size_t quoteEnd = attrStr.find('"', quoteStart + 1);
-                    if (quoteEnd == std::string::npos) break;
-
-                    std::string val = attrStr.substr(quoteStart + 1, quoteEnd - quoteStart - 1);
-                    element->attributes[key] = val;
-                    attrPos = quoteEnd + 1;
+            if (p[1] == '?') {
+                char* end = std::strstr(p + 2, "?>");
+                if (!end) return XML_ERROR_PARSING;
+                p = end + 2;
+                continue;
+            }
+
+            if (p[1] == '!') { // DOCTYPE and friends; internal subsets aren't supported
+                char* end = std::strchr(p, '>');
+                if (!end) return XML_ERROR_PARSING;
+                p = end + 1;
+                continue;
+            }
+
+            if (p[1] == '/') { // Closing tag; must match the open element
+                char* end = std::strchr(p, '>');
+                if (!end || !current) return XML_ERROR_PARSING;
+                char* nameEnd = end;
+                while (nameEnd > p + 2 && IsSpace(nameEnd[-1])) nameEnd--;
+                if (std::string_view(p + 2, nameEnd - (p + 2)) != current->_name) return XML_ERROR_PARSING;
+                current = current->_parent;
+                p = end + 1;
+                continue;
+            }
+
+            // Opening tag: each slice is terminated right after its delimiter has been read
+            char* name = ++p;
+            while (!IsNameEnd(*p)) p++;
+            if (p == name) return XML_ERROR_PARSING;
+
+            XMLElement* element = NewNode(XMLNodeKind::Element);
+            element->_name = std::string_view(name, p - name);
+            element->_nameHash = XMLElement::HashName(element->_name);
+
+            bool selfClosing = false;
+            char delim = *p;
+            *p = '\0';
+            if (delim == '\0' || delim == '=') return XML_ERROR_PARSING;
+            p++;
+
+            while (delim != '>') {
+                if (delim == '/') {
+                    if (*p != '>') return XML_ERROR_PARSING;
+                    selfClosing = true;
+                    p++;
+                    break;
                 }
+
+                while (IsSpace(*p)) p++;
+                if (*p == '/' || *p == '>') {
+                    delim = *p++;
+                    continue;
+                }
+
+                char* attrName = p;
+                while (!IsNameEnd(*p)) p++;
+                if (p == attrName) return XML_ERROR_PARSING;
+                size_t attrNameLength = p - attrName;
+
+                while (IsSpace(*p)) p++;
+                if (*p != '=') return XML_ERROR_PARSING;
+                attrName[attrNameLength] = '\0';
+                p++;
+                while (IsSpace(*p)) p++;
+
+                char quote = *p;
+                if (quote != '"' && quote != '\'') return XML_ERROR_PARSING;
+                char* value = ++p;
+                char* valueEnd = std::strchr(value, quote);
+                if (!valueEnd) return XML_ERROR_PARSING;
+
+                XMLAttribute* attr = element->AddAttribute(_arena);
+                attr->name = std::string_view(attrName, attrNameLength);
+                attr->valueCapacity = valueEnd - value;
+                attr->value = std::string_view(value, DecodeInPlace(value, valueEnd));
+                p = valueEnd + 1;
+                delim = ' ';
             }
 
-            if (!root) {
-                root = element;
-            } else if (current) {
-                current->children.push_back(element);
+            if (current) {
+                current->AppendChild(element);
+            } else {
+                AppendTopLevel(element);
+                if (!_root) _root = element;
             }
+            if (!selfClosing) current = element;
+        }
+
+        // A truncated file (e.g. read mid-save) leaves elements open
+        return (_root && !current) ? XML_SUCCESS : XML_ERROR_PARSING;
+    }
+
+    static void Indent(std::string& out, int indent) {
+        out.append(indent * 4, ' ');
+    }
 
-            if (!selfClosing) {
-                current = element;
+    static void Serialize(std::string& out, const XMLElement* node, int indent) {
+        Indent(out, indent);
+        if (node->_kind == XMLNodeKind::Comment) {
+            out += "<!--";
+            out += node->_text;
+            out += "-->\n";
+            return;
+        }
+
+        out += "<";
+        out += node->_name;
+        for (int i = 0; i < node->_attrCount; i++) {
+            out += " ";
+            out += node->_attrs[i].name;
+            out += "=\"";
+            Escape(out, node->_attrs[i].value, true);
+            out += "\"";
+        }
+
+        if (!node->_firstChild && node->_text.empty()) {
+            out += " />\n";
+            return;
+        }
+
+        out += ">";
+        if (!node->_firstChild) {
+            Escape(out, node->_text, false);
+        } else {
+            out += "\n";
+            if (!node->_text.empty()) {
+                Indent(out, indent + 1);
+                Escape(out, node->_text, false);
+                out += "\n";
             }
-            pos = end + 1;
+            for (const XMLElement* child = node->_firstChild; child; child = child->_next) {
+                Serialize(out, child, indent + 1);
+            }
+            Indent(out, indent);
         }
+        out += "</";
+        out += node->_name;
+        out += ">\n";
     }
-    XMLElement* root = nullptr;
+
+    XMLArena _arena;
+    std::vector<char> _buffer;
+    XMLElement* _root = nullptr;
+    XMLElement* _top = nullptr; // Top-level nodes, including comments around the root
+    XMLError _error = XML_SUCCESS;
 };
 
+inline void XMLElement::SetAttribute(const char* attr, const char* value) {
+    std::string_view newValue(value);
+    XMLAttribute* found = const_cast<XMLAttribute*>(FindAttribute(attr));
+    if (!found) {
+        found = AddAttribute(_doc->_arena);
+        found->name = _doc->_arena.CopyString(attr);
+        found->value = std::string_view(); // Arena memory is uninitialized
+        found->valueCapacity = 0;
+    }
+
+    // Rewrite in place when it fits, so repeated edits don't keep growing the arena.
+    // A new attribute has no storage yet, even for an empty value.
+    if (found->value.data() && newValue.size() <= found->valueCapacity) {
+        char* storage = const_cast<char*>(found->value.data());
+        std::memcpy(storage, newValue.data(), newValue.size());
+        storage[newValue.size()] = '\0';
+        found->value = std::string_view(storage, newValue.size());
+    } else {
+        found->value = _doc->_arena.CopyString(newValue);
+        found->valueCapacity = newValue.size();
+    }
+}
+
+inline XMLElement* XMLElement::InsertNewChild(const char* childName) {
+    XMLElement* element = _doc->NewNode(XMLNodeKind::Element);
+    element->_name = _doc->_arena.CopyString(childName);
+    element->_nameHash = HashName(element->_name);
+    AppendChild(element);
+    return element;
+}
+
 } // namespace tinyxml2
 
 #endif
@@ -0,0 +1,307 @@
+// Headless definitions of the natives declared in sdk/natives.h.
+// Each one counts itself and forwards to FakeWorld; arguments the fake world
+// has no use for (network flags, rotation, unknowns) are ignored.
+#include "natives.h"
+#include "FakeWorld.h"
+#include <string>
+
+namespace {
+
+FakeWorld& World() {
+    FakeWorld& world = FakeWorld::Get();
+    world.CountCall();
+    return world;
+}
+
+std::string ModelKey(Hash model) {
+    return "model:" + std::to_string(model);
+}
+
+std::string PtfxKey(const char* name) {
+    return std::string("ptfx:") + name;
+}
+
+Vector3 Vec(float x, float y, float z) {
+    return { x, 0, y, 0, z, 0 };
+}
+
+} // namespace
+
+void scriptWait(DWORD) {
+    World();
+}
+
+int worldGetAllVehicles(int* arr, int arrSize) {
+    return World().Collect(FakeWorld::Kind::Vehicle, arr, arrSize);
+}
+
+int worldGetAllPeds(int* arr, int arrSize) {
+    return World().Collect(FakeWorld::Kind::Ped, arr, arrSize);
+}
+
+int worldGetAllObjects(int* arr, int arrSize) {
+    return World().Collect(FakeWorld::Kind::Object, arr, arrSize);
+}
+
+namespace PED {
+    BOOL IS_PED_RAGDOLL(Ped ped) {
+        FakeWorld& world = World();
+        FakeWorld::Body* body = world.Find(ped);
+        return body && world.GetGameTime() < body->ragdollUntil;
+    }
+
+    BOOL SET_PED_TO_RAGDOLL(Ped ped, int time1, int, int, BOOL, BOOL, BOOL) {
+        FakeWorld& world = World();
+        FakeWorld::Body* body = world.Find(ped);
+        if (!body || body->kind != FakeWorld::Kind::Ped) return FALSE;
+        body->ragdollUntil = world.GetGameTime() + time1;
+        return TRUE;
+    }
+}
+
+namespace VEHICLE {
+    BOOL IS_THIS_MODEL_A_BOAT(Hash model) { return World().GetModelInfo(model).boat; }
+    BOOL IS_THIS_MODEL_A_PLANE(Hash model) { return World().GetModelInfo(model).plane; }
+    BOOL IS_THIS_MODEL_A_HELI(Hash model) { return World().GetModelInfo(model).heli; }
+    int GET_VEHICLE_CLASS_FROM_NAME(Hash modelHash) { return World().GetModelInfo(modelHash).vehicleClass; }
+}
+
+namespace ENTITY {
+    BOOL DOES_ENTITY_EXIST(Entity entity) {
+        return World().Exists(entity);
+    }
+
+    Vector3 GET_ENTITY_COORDS(Entity entity, BOOL) {
+        FakeWorld::Body* body = World().Find(entity);
+        return body ? body->position : Vec(0.0f, 0.0f, 0.0f);
+    }
+
+    Vector3 GET_ENTITY_FORWARD_VECTOR(Entity) {
+        World();
+        return Vec(0.0f, 1.0f, 0.0f);
+    }
+
+    float GET_ENTITY_HEIGHT_ABOVE_GROUND(Entity entity) {
+        FakeWorld& world = World();
+        FakeWorld::Body* body = world.Find(entity);
+        return body ? body->position.z - world.GetGroundZ() : 0.0f;
+    }
+
+    Hash GET_ENTITY_MODEL(Entity entity) {
+        FakeWorld::Body* body = World().Find(entity);
+        return body ? body->model : 0;
+    }
+
+    void APPLY_FORCE_TO_ENTITY(Entity entity, int, float x, float y, float z, float, float, float,
+                               int, BOOL, BOOL, BOOL, BOOL, BOOL) {
+        World().ApplyForce(entity, x, y, z);
+    }
+
+    void APPLY_FORCE_TO_ENTITY_CENTER_OF_MASS(Entity entity, int, float x, float y, float z,
+                                              BOOL, BOOL, BOOL, BOOL) {
+        World().ApplyForce(entity, x, y, z);
+    }
+
+    void DELETE_ENTITY(Entity* entity) {
+        World().Delete(*entity);
+        *entity = 0;
+    }
+
+    void FREEZE_ENTITY_POSITION(Entity entity, BOOL toggle) {
+        FakeWorld::Body* body = World().Find(entity);
+        if (!body) return;
+        body->frozen = toggle != FALSE;
+        if (body->frozen) body->velocity = Vec(0.0f, 0.0f, 0.0f);
+    }
+
+    void SET_ENTITY_ALPHA(Entity, int, BOOL) {
+        World();
+    }
+
+    void SET_ENTITY_AS_MISSION_ENTITY(Entity entity, BOOL, BOOL) {
+        FakeWorld::Body* body = World().Find(entity);
+        if (body) body->mission = true;
+    }
+
+    void SET_ENTITY_COLLISION(Entity entity, BOOL toggle, BOOL) {
+        FakeWorld::Body* body = World().Find(entity);
+        if (body) body->collision = toggle != FALSE;
+    }
+
+    void SET_ENTITY_COORDS(Entity entity, float xPos, float yPos, float zPos, BOOL, BOOL, BOOL, BOOL) {
+        FakeWorld::Body* body = World().Find(entity);
+        if (body) body->position = Vec(xPos, yPos, zPos);
+    }
+
+    void SET_ENTITY_MAX_SPEED(Entity entity, float speed) {
+        FakeWorld::Body* body = World().Find(entity);
+        if (body) body->maxSpeed = speed;
+    }
+
+    void SET_ENTITY_VISIBLE(Entity entity, BOOL toggle, BOOL) {
+        FakeWorld::Body* body = World().Find(entity);
+        if (body) body->visible = toggle != FALSE;
+    }
+
+    void _0x3910051CCECDB00C(Entity, BOOL) {
+        World();
+    }
+}
+
+namespace OBJECT {
+    Object CREATE_OBJECT(Object modelHash, float x, float y, float z, BOOL, BOOL, BOOL) {
+        FakeWorld& world = World();
+        // The game refuses to create a model that has not been streamed in
+        if (!world.IsAssetLoaded(ModelKey((Hash)modelHash))) return 0;
+        return world.Spawn(FakeWorld::Kind::Object, Vec(x, y, z), (Hash)modelHash);
+    }
+}
+
+namespace PATHFIND {
+    BOOL GET_CLOSEST_VEHICLE_NODE(float x, float y, float, Vector3* outPosition, int, float, float) {
+        FakeWorld& world = World();
+        *outPosition = Vec(x, y, world.GetGroundZ());
+        return TRUE;
+    }
+}
+
+namespace CONTROLS {
+    BOOL _SET_CONTROL_NORMAL(int, int, float) {
+        World();
+        return TRUE;
+    }
+}
+
+namespace CAM {
+    void SHAKE_GAMEPLAY_CAM(char*, float) {
+        World();
+    }
+}
+
+namespace WORLDPROBE {
+    int _START_SHAPE_TEST_RAY(float, float, float, float, float, float, int, Entity, int) {
+        return World().StartShapeTest();
+    }
+
+    int _GET_RAYCAST_RESULT(int rayHandle, BOOL* hit, Vector3* endCoords, Vector3* surfaceNormal, Entity* entityHit) {
+        bool didHit = false;
+        int status = World().PollShapeTest(rayHandle, didHit);
+        *hit = didHit;
+        *endCoords = Vec(0.0f, 0.0f, 0.0f);
+        *surfaceNormal = Vec(0.0f, 0.0f, 1.0f);
+        *entityHit = 0;
+        return status;
+    }
+}
+
+namespace UI {
+    void BEGIN_TEXT_COMMAND_SET_BLIP_NAME(char*) { World(); }
+    void _ADD_TEXT_COMPONENT_STRING(char*) { World(); }
+    void END_TEXT_COMMAND_SET_BLIP_NAME(Blip) { World(); }
+
+    Blip ADD_BLIP_FOR_COORD(float, float, float) {
+        return World().AddBlip();
+    }
+
+    void SET_BLIP_COORDS(Blip, float, float, float) { World(); }
+    void SET_BLIP_SPRITE(Blip, int) { World(); }
+    void SET_BLIP_COLOUR(Blip, int) { World(); }
+    void SET_BLIP_SCALE(Blip, float) { World(); }
+
+    void REMOVE_BLIP(Blip* blip) {
+        World().RemoveBlip(*blip);
+        *blip = 0;
+    }
+}
+
+namespace GRAPHICS {
+    int START_PARTICLE_FX_LOOPED_AT_COORD(char*, float x, float y, float z, float, float, float,
+                                          float scale, BOOL, BOOL, BOOL, BOOL) {
+        return World().StartEffect(0, Vec(x, y, z), scale);
+    }
+
+    int START_PARTICLE_FX_LOOPED_ON_ENTITY(char*, Entity entity, float xOffset, float yOffset, float zOffset,
+                                           float, float, float, float scale, BOOL, BOOL, BOOL) {
+        return World().StartEffect(entity, Vec(xOffset, yOffset, zOffset), scale);
+    }
+
+    int _START_PARTICLE_FX_LOOPED_ON_ENTITY_BONE(char*, Entity entity, float xOffset, float yOffset, float zOffset,
+                                                 float, float, float, int, float scale, BOOL, BOOL, BOOL) {
+        return World().StartEffect(entity, Vec(xOffset, yOffset, zOffset), scale);
+    }
+
+    void STOP_PARTICLE_FX_LOOPED(int ptfxHandle, BOOL) {
+        World().RemoveEffect(ptfxHandle);
+    }
+
+    void REMOVE_PARTICLE_FX(int ptfxHandle, BOOL) {
+        World().RemoveEffect(ptfxHandle);
+    }
+
+    void REMOVE_PARTICLE_FX_IN_RANGE(float X, float Y, float Z, float radius) {
+        World().RemoveEffectsInRange(Vec(X, Y, Z), radius);
+    }
+
+    BOOL DOES_PARTICLE_FX_LOOPED_EXIST(int ptfxHandle) {
+        return World().FindEffect(ptfxHandle) != nullptr;
+    }
+
+    void SET_PARTICLE_FX_LOOPED_OFFSETS(int ptfxHandle, float x, float y, float z, float, float, float) {
+        FakeWorld::Effect* effect = World().FindEffect(ptfxHandle);
+        if (effect) effect->position = Vec(x, y, z);
+    }
+
+    void SET_PARTICLE_FX_LOOPED_EVOLUTION(int, char*, float, BOOL) {
+        World();
+    }
+
+    void SET_PARTICLE_FX_LOOPED_COLOUR(int, float, float, float, BOOL) {
+        World();
+    }
+
+    void SET_PARTICLE_FX_LOOPED_ALPHA(int ptfxHandle, float alpha) {
+        FakeWorld::Effect* effect = World().FindEffect(ptfxHandle);
+        if (effect) effect->alpha = alpha;
+    }
+
+    void SET_PARTICLE_FX_LOOPED_SCALE(int ptfxHandle, float scale) {
+        FakeWorld::Effect* effect = World().FindEffect(ptfxHandle);
+        if (effect) effect->scale = scale;
+    }
+
+    void _SET_PTFX_ASSET_NEXT_CALL(char* name) {
+        World().SetNextEffectAsset(name);
+    }
+}
+
+namespace STREAMING {
+    void REQUEST_MODEL(Hash model) { World().RequestAsset(ModelKey(model)); }
+    BOOL HAS_MODEL_LOADED(Hash model) { return World().IsAssetLoaded(ModelKey(model)); }
+    void SET_MODEL_AS_NO_LONGER_NEEDED(Hash model) { World().ReleaseAsset(ModelKey(model)); }
+    void REQUEST_NAMED_PTFX_ASSET(char* fxName) { World().RequestAsset(PtfxKey(fxName)); }
+    BOOL HAS_NAMED_PTFX_ASSET_LOADED(char* fxName) { return World().IsAssetLoaded(PtfxKey(fxName)); }
+    void _REMOVE_NAMED_PTFX_ASSET(char* fxName) { World().ReleaseAsset(PtfxKey(fxName)); }
+}
+
+namespace DECISIONEVENT {
+    Any ADD_SHOCKING_EVENT_FOR_ENTITY(Any, Any, float) {
+        World();
+        return 0;
+    }
+}
+
+namespace GAMEPLAY {
+    BOOL GET_GROUND_Z_FOR_3D_COORD(float, float, float, float* groundZ, BOOL) {
+        *groundZ = World().GetGroundZ();
+        return TRUE;
+    }
+
+    BOOL IS_PREV_WEATHER_TYPE(char*) {
+        World();
+        return FALSE;
+    }
+
+    void SET_WIND_SPEED(float) {
+        World();
+    }
+}
@@ -0,0 +1,245 @@
+#include "FakeWorld.h"
+#include <cmath>
+
+namespace {
+
+float MassOf(FakeWorld::Kind kind) {
+    switch (kind) {
+    case FakeWorld::Kind::Ped: return 1.0f;
+    case FakeWorld::Kind::Vehicle: return 3.0f;
+    default: return 0.5f;
+    }
+}
+
+} // namespace
+
+FakeWorld& FakeWorld::Get() {
+    static FakeWorld world;
+    return world;
+}
+
+void FakeWorld::Reset() {
+    m_bodies.clear();
+    m_lastEntity = 0;
+    m_effects.clear();
+    m_lastEffect = 0;
+    m_nextEffectAsset.clear();
+    m_blips.clear();
+    m_lastBlip = 0;
+    m_shapeTests.clear();
+    m_lastShapeTest = 0;
+    m_requestedAssets.clear();
+    m_loadedAssets.clear();
+    m_models.clear();
+    notifications.clear();
+
+    m_frame = 0;
+    m_gameTime = 0;
+    m_frameTime = 0.0f;
+    m_groundZ = 0.0f;
+    m_rainLevel = 0.0f;
+    m_nativeCalls = 0;
+
+    // The game keeps the core effect dictionary resident
+    m_loadedAssets.insert("ptfx:core");
+
+    m_playerPed = Spawn(Kind::Ped, { 0.0f, 0, 0.0f, 0, 0.0f, 0 });
+}
+
+void FakeWorld::Step(float frameTime) {
+    m_frame++;
+    m_frameTime = frameTime;
+    m_gameTime += (int)std::lround(frameTime * 1000.0f);
+
+    for (auto& pair : m_bodies) {
+        Body& body = pair.second;
+        if (body.frozen) continue;
+
+        bool airborne = body.position.z > m_groundZ || body.velocity.z > 0.0f;
+        if (airborne) {
+            body.velocity.z += GRAVITY * frameTime;
+        }
+
+        if (body.maxSpeed > 0.0f) {
+            float speed = std::sqrt(body.velocity.x * body.velocity.x + body.velocity.y * body.velocity.y + body.velocity.z * body.velocity.z);
+            if (speed > body.maxSpeed) {
+                float scale = body.maxSpeed / speed;
+                body.velocity.x *= scale;
+                body.velocity.y *= scale;
+                body.velocity.z *= scale;
+            }
+        }
+
+        body.position.x += body.velocity.x * frameTime;
+        body.position.y += body.velocity.y * frameTime;
+        body.position.z += body.velocity.z * frameTime;
+
+        // Landing stops the fall and ground friction bleeds off the rest
+        if (body.position.z <= m_groundZ) {
+            body.position.z = m_groundZ;
+            body.velocity.z = 0.0f;
+            body.velocity.x *= 0.8f;
+            body.velocity.y *= 0.8f;
+        }
+    }
+
+    for (auto& pair : m_requestedAssets) {
+        if (m_frame - pair.second >= STREAMING_FRAMES) {
+            m_loadedAssets.insert(pair.first);
+        }
+    }
+}
+
+FrameContext FakeWorld::CaptureFrame() const {
+    FrameContext frame;
+    frame.gameTime = m_gameTime;
+    frame.frameTime = m_frameTime;
+    frame.playerPed = m_playerPed;
+    frame.playerVehicle = 0;
+
+    auto it = m_bodies.find(m_playerPed);
+    if (it != m_bodies.end()) {
+        frame.playerPos = it->second.position;
+    }
+
+    // Chase camera behind the player, looking north
+    frame.camPos = { frame.playerPos.x, 0, frame.playerPos.y - 6.0f, 0, frame.playerPos.z + 2.0f, 0 };
+    frame.camForward = { 0.0f, 0, 1.0f, 0, 0.0f, 0 };
+    frame.rainLevel = m_rainLevel;
+    return frame;
+}
+
+Entity FakeWorld::Spawn(Kind kind, const Vector3& position, Hash model) {
+    Body body;
+    body.kind = kind;
+    body.model = model;
+    body.position = position;
+    m_bodies[++m_lastEntity] = body;
+    return m_lastEntity;
+}
+
+void FakeWorld::Delete(Entity entity) {
+    if (!m_bodies.erase(entity)) return;
+
+    // Effects attached to an entity go with it
+    for (auto it = m_effects.begin(); it != m_effects.end();) {
+        if (it->second.entity == entity) {
+            it = m_effects.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+FakeWorld::Body* FakeWorld::Find(Entity entity) {
+    auto it = m_bodies.find(entity);
+    return it != m_bodies.end() ? &it->second : nullptr;
+}
+
+int FakeWorld::Collect(Kind kind, int* out, int capacity) const {
+    int count = 0;
+    for (const auto& pair : m_bodies) {
+        if (count >= capacity) break;
+        if (pair.second.kind == kind) {
+            out[count++] = pair.first;
+        }
+    }
+    return count;
+}
+
+int FakeWorld::Count(Kind kind) const {
+    int count = 0;
+    for (const auto& pair : m_bodies) {
+        if (pair.second.kind == kind) count++;
+    }
+    return count;
+}
+
+void FakeWorld::ApplyForce(Entity entity, float x, float y, float z) {
+    Body* body = Find(entity);
+    if (!body || body->frozen) return;
+
+    float mass = MassOf(body->kind);
+    body->velocity.x += x / mass;
+    body->velocity.y += y / mass;
+    body->velocity.z += z / mass;
+}
+
+const FakeWorld::ModelInfo& FakeWorld::GetModelInfo(Hash model) const {
+    static const ModelInfo none;
+    auto it = m_models.find(model);
+    return it != m_models.end() ? it->second : none;
+}
+
+void FakeWorld::RequestAsset(const std::string& key) {
+    if (m_loadedAssets.count(key)) return;
+    m_requestedAssets.emplace(key, m_frame);
+}
+
+bool FakeWorld::IsAssetLoaded(const std::string& key) const {
+    return m_loadedAssets.count(key) != 0;
+}
+
+void FakeWorld::ReleaseAsset(const std::string& key) {
+    m_requestedAssets.erase(key);
+    m_loadedAssets.erase(key);
+}
+
+int FakeWorld::StartEffect(Entity entity, const Vector3& position, float scale) {
+    // Like the game, an effect needs its asset streamed in and named beforehand
+    bool assetReady = !m_nextEffectAsset.empty() && IsAssetLoaded("ptfx:" + m_nextEffectAsset);
+    m_nextEffectAsset.clear();
+    if (!assetReady) return 0;
+    if (entity != 0 && !Exists(entity)) return 0;
+
+    Effect effect;
+    effect.entity = entity;
+    effect.position = position;
+    effect.scale = scale;
+    m_effects[++m_lastEffect] = effect;
+    return m_lastEffect;
+}
+
+FakeWorld::Effect* FakeWorld::FindEffect(int handle) {
+    auto it = m_effects.find(handle);
+    return it != m_effects.end() ? &it->second : nullptr;
+}
+
+void FakeWorld::RemoveEffect(int handle) {
+    m_effects.erase(handle);
+}
+
+void FakeWorld::RemoveEffectsInRange(const Vector3& center, float radius) {
+    for (auto it = m_effects.begin(); it != m_effects.end();) {
+        Vector3 pos = it->second.position;
+        if (it->second.entity != 0) {
+            Body* body = Find(it->second.entity);
+            if (body) pos = body->position;
+        }
+
+        float dx = pos.x - center.x;
+        float dy = pos.y - center.y;
+        float dz = pos.z - center.z;
+        if (dx * dx + dy * dy + dz * dz <= radius * radius) {
+            it = m_effects.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+int FakeWorld::StartShapeTest() {
+    m_shapeTests[++m_lastShapeTest] = m_frame;
+    return m_lastShapeTest;
+}
+
+int FakeWorld::PollShapeTest(int handle, bool& hit) {
+    hit = false;
+    auto it = m_shapeTests.find(handle);
+    if (it == m_shapeTests.end()) return 0; // Unknown handle: failed
+
+    if (it->second == m_frame) return 1; // Pending until the next frame
+
+    m_shapeTests.erase(it);
+    return 2;
+}
@@ -0,0 +1,143 @@
+#pragma once
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "types.h"
+#include "FrameContext.h"
+
+// The game as seen through sdk/natives.h in the headless build.
+// FakeNatives.cpp implements every declared native against this state:
+// entities with simple ballistic motion over a flat ground plane, a game
+// timer that only moves when Step() is called, asset streaming that
+// completes a few frames after a request, looped particle effects, blips and
+// shape tests answered on the frame after they start. Nothing reads the wall
+// clock, so a run is repeatable apart from the mod's own random draws.
+class FakeWorld {
+public:
+    enum class Kind : unsigned char {
+        Ped,
+        Vehicle,
+        Object
+    };
+
+    struct Body {
+        Kind kind = Kind::Object;
+        Hash model = 0;
+        Vector3 position = { 0.0f, 0, 0.0f, 0, 0.0f, 0 };
+        Vector3 velocity = { 0.0f, 0, 0.0f, 0, 0.0f, 0 };
+        float maxSpeed = 0.0f; // 0 is unlimited
+        bool frozen = false;
+        int ragdollUntil = 0; // Game time
+        bool mission = false;
+        bool visible = true;
+        bool collision = true;
+    };
+
+    struct Effect {
+        Entity entity = 0; // 0 for effects started at a coordinate
+        Vector3 position = { 0.0f, 0, 0.0f, 0, 0.0f, 0 };
+        float scale = 1.0f;
+        float alpha = 1.0f;
+    };
+
+    struct ModelInfo {
+        int vehicleClass = 0;
+        bool plane = false;
+        bool heli = false;
+        bool boat = false;
+    };
+
+    static FakeWorld& Get();
+
+    // Empties the world and spawns the player ped at the origin
+    void Reset();
+
+    // Advances the game timer by frameTime and moves every unfrozen body
+    void Step(float frameTime);
+    int GetGameTime() const { return m_gameTime; }
+    float GetFrameTime() const { return m_frameTime; }
+
+    // What script.cpp's CaptureFrameContext would read this frame
+    FrameContext CaptureFrame() const;
+
+    // Entities
+    Entity Spawn(Kind kind, const Vector3& position, Hash model = 0);
+    void Delete(Entity entity);
+    bool Exists(Entity entity) const { return m_bodies.count(entity) != 0; }
+    Body* Find(Entity entity);
+    int Collect(Kind kind, int* out, int capacity) const;
+    int Count(Kind kind) const;
+    Entity GetPlayerPed() const { return m_playerPed; }
+    // Forces become a velocity change divided by a per-kind mass
+    void ApplyForce(Entity entity, float x, float y, float z);
+
+    void SetGroundZ(float z) { m_groundZ = z; }
+    float GetGroundZ() const { return m_groundZ; }
+    void SetRainLevel(float level) { m_rainLevel = level; }
+    void DefineModel(Hash model, const ModelInfo& info) { m_models[model] = info; }
+    const ModelInfo& GetModelInfo(Hash model) const;
+
+    // Streaming: a requested asset reports loaded STREAMING_FRAMES steps later
+    void RequestAsset(const std::string& key);
+    bool IsAssetLoaded(const std::string& key) const;
+    void ReleaseAsset(const std::string& key);
+    int GetLoadedAssetCount() const { return (int)m_loadedAssets.size(); }
+
+    // Looped particle effects
+    void SetNextEffectAsset(const std::string& asset) { m_nextEffectAsset = asset; }
+    int StartEffect(Entity entity, const Vector3& position, float scale);
+    Effect* FindEffect(int handle);
+    void RemoveEffect(int handle);
+    void RemoveEffectsInRange(const Vector3& center, float radius);
+    int GetEffectCount() const { return (int)m_effects.size(); }
+
+    // Blips
+    Blip AddBlip() { m_blips.insert(++m_lastBlip); return m_lastBlip; }
+    void RemoveBlip(Blip blip) { m_blips.erase(blip); }
+    int GetBlipCount() const { return (int)m_blips.size(); }
+
+    // Shape tests never hit anything; a test is forgotten once its result is read
+    int StartShapeTest();
+    int PollShapeTest(int handle, bool& hit);
+    int GetPendingShapeTestCount() const { return (int)m_shapeTests.size(); }
+
+    // Every native call made through sdk/natives.h
+    void CountCall() { m_nativeCalls++; }
+    long long GetNativeCallCount() const { return m_nativeCalls; }
+
+    std::vector<std::string> notifications;
+
+    static const int STREAMING_FRAMES = 2;
+    static constexpr float GRAVITY = -9.81f;
+
+private:
+    FakeWorld() { Reset(); }
+
+    std::map<Entity, Body> m_bodies; // Handles only grow, so this is spawn order like the game's pools
+    Entity m_lastEntity = 0;
+    Entity m_playerPed = 0;
+
+    std::unordered_map<int, Effect> m_effects;
+    int m_lastEffect = 0;
+    std::string m_nextEffectAsset;
+
+    std::unordered_set<Blip> m_blips;
+    Blip m_lastBlip = 0;
+
+    std::unordered_map<int, int> m_shapeTests; // Handle -> frame it was started on
+    int m_lastShapeTest = 0;
+
+    std::unordered_map<std::string, int> m_requestedAssets; // Key -> frame it was requested on
+    std::unordered_set<std::string> m_loadedAssets;
+
+    std::unordered_map<Hash, ModelInfo> m_models;
+
+    int m_frame = 0;
+    int m_gameTime = 0;
+    float m_frameTime = 0.0f;
+    float m_groundZ = 0.0f;
+    float m_rainLevel = 0.0f;
+    long long m_nativeCalls = 0;
+};
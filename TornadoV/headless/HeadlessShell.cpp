@@ -0,0 +1,40 @@
+// The few pieces of the mod's shell that the simulation sources and the
+// config watcher reach into. IniHelper.cpp, XmlHelper.cpp and the menu need
+// Win32 resources or the game, so the headless build defines only what is
+// called, and records it in HeadlessShell (IniHelper's store and adopt path
+// are in IniSettings.cpp and linked for real); AudioManager runs on SoLoud built
+// WITH_NULL, which never opens a device.
+#include "HeadlessShell.h"
+#include "IniHelper.h"
+#include "XmlHelper.h"
+#include "TornadoMenu.h"
+#include "FakeWorld.h"
+#include "soloud.h"
+#include "soloud_internal.h"
+
+std::shared_ptr<tinyxml2::XMLDocument> HeadlessShell::adoptedXml;
+int HeadlessShell::iniReloads = 0;
+int HeadlessShell::xmlReloads = 0;
+
+void IniHelper::ShowNotification(const std::string& message) {
+    FakeWorld::Get().notifications.push_back(message);
+}
+
+void XmlHelper::Adopt(std::shared_ptr<tinyxml2::XMLDocument> doc) {
+    HeadlessShell::adoptedXml = std::move(doc);
+}
+
+void TornadoMenu::LoadIniSettings() {
+    HeadlessShell::iniReloads++;
+}
+
+void TornadoMenu::LoadXmlSettings() {
+    HeadlessShell::xmlReloads++;
+}
+
+namespace SoLoud {
+    // Only reached through Soloud::init(NULLDRIVER); AudioManager asks for AUTO
+    result null_init(Soloud*, unsigned int, unsigned int, unsigned int, unsigned int) {
+        return NOT_IMPLEMENTED;
+    }
+}
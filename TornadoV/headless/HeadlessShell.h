@@ -0,0 +1,12 @@
+#pragma once
+#include <memory>
+
+namespace tinyxml2 { class XMLDocument; }
+
+// What the headless stand-ins for the menu and XmlHelper were handed, so
+// tests can see a hot reload land without the real UI
+struct HeadlessShell {
+    static std::shared_ptr<tinyxml2::XMLDocument> adoptedXml;
+    static int iniReloads; // TornadoMenu::LoadIniSettings calls
+    static int xmlReloads; // TornadoMenu::LoadXmlSettings calls
+};
@@ -0,0 +1,88 @@
+// Runs the mod's micro-benchmarks off the game, plus whole factory frames
+// against FakeWorld, and writes them in the same JSON as the menu's
+// "Run Benchmarks" entry.
+//
+//   tornadov_bench [output.json]
+#include "Benchmark.h"
+#include "FakeWorld.h"
+#include "TornadoFactory.h"
+#include "AssetCache.h"
+#include "FrameBudget.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace {
+
+const float FRAME_TIME = 1.0f / 30.0f;
+const int WARMUP_FRAMES = 600;
+const int TIMED_FRAMES = 600;
+
+// One built vortex with a crowd of peds and cars around it, timed per frame
+void RunFactoryFrame(std::vector<BenchmarkResult>& results) {
+    FakeWorld& world = FakeWorld::Get();
+    world.Reset();
+
+    TornadoSettings settings;
+    settings.spawnInStorm = false;
+    settings.followPlayer = false;
+    settings.movementEnabled = false;
+    settings.frameBudgetMs = 1000.0f; // Time everything the vortex wants to do
+
+    for (int i = 0; i < 400; i++) {
+        float x = (float)(i % 20) * 5.0f - 50.0f;
+        float y = 80.0f + (float)(i / 20) * 5.0f - 50.0f;
+        world.Spawn(i % 4 == 0 ? FakeWorld::Kind::Vehicle : FakeWorld::Kind::Ped, { x, 0, y, 0, 0.0f, 0 });
+    }
+
+    TornadoFactory factory(settings);
+    std::vector<double> samples;
+    long long callsBefore = 0;
+
+    for (int i = 0; i < WARMUP_FRAMES + TIMED_FRAMES; i++) {
+        if (i == 90) factory.CreateVortex({ 0.0f, 0, 80.0f, 0, 0.0f, 0 });
+        if (i == WARMUP_FRAMES) callsBefore = world.GetNativeCallCount();
+
+        world.Step(FRAME_TIME);
+        FrameContext frame = world.CaptureFrame();
+
+        auto start = std::chrono::steady_clock::now();
+        FrameBudget budget(settings.frameBudgetMs * 1000.0f);
+        AssetCache::Get().Update();
+        factory.OnUpdate(frame, settings, budget);
+        auto end = std::chrono::steady_clock::now();
+
+        if (i >= WARMUP_FRAMES) {
+            samples.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+        }
+    }
+
+    std::sort(samples.begin(), samples.end());
+    results.push_back({ "Simulation/FactoryFrame", 1, samples[samples.size() / 2], samples.front() });
+
+    long long calls = world.GetNativeCallCount() - callsBefore;
+    std::printf("Simulation/FactoryFrame: %d particles, %lld natives per frame\n",
+        factory.GetFirstVortex() ? factory.GetFirstVortex()->GetParticleCount() : 0, calls / TIMED_FRAMES);
+
+    factory.Dispose();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* outPath = argc > 1 ? argv[1] : "TornadoVBench.json";
+
+    std::vector<BenchmarkResult> results = Benchmark::RunAll();
+    RunFactoryFrame(results);
+
+    for (const BenchmarkResult& result : results) {
+        std::printf("%-40s %12.1f ns %12.1f ns min\n", result.name.c_str(), result.nsPerOp, result.nsPerOpMin);
+    }
+
+    if (!Benchmark::WriteJson(results, outPath, "tornadov_bench")) {
+        std::fprintf(stderr, "Could not write %s\n", outPath);
+        return 1;
+    }
+    std::printf("Results written to %s\n", outPath);
+    return 0;
+}
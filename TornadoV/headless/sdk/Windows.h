@@ -0,0 +1,3 @@
+#pragma once
+// Some mod headers spell it <Windows.h>; case matters off Windows
+#include "windows.h"
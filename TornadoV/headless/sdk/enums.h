@@ -0,0 +1,2 @@
+#pragma once
+// Headless build: the mod does not use any of the SDK's enums, main.h just includes them.
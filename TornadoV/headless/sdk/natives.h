@@ -0,0 +1,127 @@
+#pragma once
+// Headless build: the native-dispatch seam.
+//
+// In the game, natives.h is the ScriptHookV SDK header and every call below
+// goes through ScriptHookV into GTA V. The headless build puts this header on
+// the include path instead: it declares the natives the simulation sources
+// (physics/, AssetCache, LoopedParticle) call, with the SDK's signatures, and
+// headless/FakeNatives.cpp implements them against FakeWorld. The mod's
+// sources compile unchanged against either.
+//
+// Natives used only by the menu, script loop and UI are not declared here;
+// those translation units are not part of the headless build.
+#include "types.h"
+
+// ScriptHookV exports (main.h in the SDK)
+void scriptWait(DWORD time);
+int worldGetAllVehicles(int* arr, int arrSize);
+int worldGetAllPeds(int* arr, int arrSize);
+int worldGetAllObjects(int* arr, int arrSize);
+
+#ifndef WAIT
+#define WAIT(ms) scriptWait(ms)
+#endif
+
+namespace PED {
+    BOOL IS_PED_RAGDOLL(Ped ped);
+    BOOL SET_PED_TO_RAGDOLL(Ped ped, int time1, int time2, int ragdollType, BOOL p4, BOOL p5, BOOL p6);
+}
+
+namespace VEHICLE {
+    BOOL IS_THIS_MODEL_A_BOAT(Hash model);
+    BOOL IS_THIS_MODEL_A_PLANE(Hash model);
+    BOOL IS_THIS_MODEL_A_HELI(Hash model);
+    int GET_VEHICLE_CLASS_FROM_NAME(Hash modelHash);
+}
+
+namespace ENTITY {
+    BOOL DOES_ENTITY_EXIST(Entity entity);
+    Vector3 GET_ENTITY_COORDS(Entity entity, BOOL alive);
+    Vector3 GET_ENTITY_FORWARD_VECTOR(Entity entity);
+    float GET_ENTITY_HEIGHT_ABOVE_GROUND(Entity entity);
+    Hash GET_ENTITY_MODEL(Entity entity);
+    void APPLY_FORCE_TO_ENTITY(Entity entity, int forceType, float x, float y, float z, float xRot, float yRot, float zRot,
+                               int p8, BOOL isRel, BOOL ignoreUpVec, BOOL p11, BOOL p12, BOOL p13);
+    void APPLY_FORCE_TO_ENTITY_CENTER_OF_MASS(Entity entity, int forceType, float x, float y, float z,
+                                              BOOL p5, BOOL isRel, BOOL highForce, BOOL p8);
+    void DELETE_ENTITY(Entity* entity);
+    void FREEZE_ENTITY_POSITION(Entity entity, BOOL toggle);
+    void SET_ENTITY_ALPHA(Entity entity, int alphaLevel, BOOL unk);
+    void SET_ENTITY_AS_MISSION_ENTITY(Entity entity, BOOL p1, BOOL p2);
+    void SET_ENTITY_COLLISION(Entity entity, BOOL toggle, BOOL keepPhysics);
+    void SET_ENTITY_COORDS(Entity entity, float xPos, float yPos, float zPos, BOOL xAxis, BOOL yAxis, BOOL zAxis, BOOL clearArea);
+    void SET_ENTITY_MAX_SPEED(Entity entity, float speed);
+    void SET_ENTITY_VISIBLE(Entity entity, BOOL toggle, BOOL unk);
+    void _0x3910051CCECDB00C(Entity entity, BOOL p1);
+}
+
+namespace OBJECT {
+    Object CREATE_OBJECT(Object modelHash, float x, float y, float z, BOOL isNetwork, BOOL thisScriptCheck, BOOL dynamic);
+}
+
+namespace PATHFIND {
+    BOOL GET_CLOSEST_VEHICLE_NODE(float x, float y, float z, Vector3* outPosition, int nodeType, float p5, float p6);
+}
+
+namespace CONTROLS {
+    BOOL _SET_CONTROL_NORMAL(int inputGroup, int control, float amount);
+}
+
+namespace CAM {
+    void SHAKE_GAMEPLAY_CAM(char* shakeName, float intensity);
+}
+
+namespace WORLDPROBE {
+    int _START_SHAPE_TEST_RAY(float x1, float y1, float z1, float x2, float y2, float z2, int flags, Entity entity, int p8);
+    int _GET_RAYCAST_RESULT(int rayHandle, BOOL* hit, Vector3* endCoords, Vector3* surfaceNormal, Entity* entityHit);
+}
+
+namespace UI {
+    void BEGIN_TEXT_COMMAND_SET_BLIP_NAME(char* type);
+    void _ADD_TEXT_COMPONENT_STRING(char* text);
+    void END_TEXT_COMMAND_SET_BLIP_NAME(Blip blip);
+    Blip ADD_BLIP_FOR_COORD(float x, float y, float z);
+    void SET_BLIP_COORDS(Blip blip, float x, float y, float z);
+    void SET_BLIP_SPRITE(Blip blip, int spriteId);
+    void SET_BLIP_COLOUR(Blip blip, int color);
+    void SET_BLIP_SCALE(Blip blip, float scale);
+    void REMOVE_BLIP(Blip* blip);
+}
+
+namespace GRAPHICS {
+    int START_PARTICLE_FX_LOOPED_AT_COORD(char* effectName, float x, float y, float z, float xRot, float yRot, float zRot,
+                                          float scale, BOOL p8, BOOL p9, BOOL p10, BOOL p11);
+    int START_PARTICLE_FX_LOOPED_ON_ENTITY(char* effectName, Entity entity, float xOffset, float yOffset, float zOffset,
+                                           float xRot, float yRot, float zRot, float scale, BOOL p9, BOOL p10, BOOL p11);
+    int _START_PARTICLE_FX_LOOPED_ON_ENTITY_BONE(char* effectName, Entity entity, float xOffset, float yOffset, float zOffset,
+                                                 float xRot, float yRot, float zRot, int boneIndex, float scale, BOOL p10, BOOL p11, BOOL p12);
+    void STOP_PARTICLE_FX_LOOPED(int ptfxHandle, BOOL p1);
+    void REMOVE_PARTICLE_FX(int ptfxHandle, BOOL p1);
+    void REMOVE_PARTICLE_FX_IN_RANGE(float X, float Y, float Z, float radius);
+    BOOL DOES_PARTICLE_FX_LOOPED_EXIST(int ptfxHandle);
+    void SET_PARTICLE_FX_LOOPED_OFFSETS(int ptfxHandle, float x, float y, float z, float rotX, float rotY, float rotZ);
+    void SET_PARTICLE_FX_LOOPED_EVOLUTION(int ptfxHandle, char* propertyName, float amount, BOOL Id);
+    void SET_PARTICLE_FX_LOOPED_COLOUR(int ptfxHandle, float r, float g, float b, BOOL p4);
+    void SET_PARTICLE_FX_LOOPED_ALPHA(int ptfxHandle, float alpha);
+    void SET_PARTICLE_FX_LOOPED_SCALE(int ptfxHandle, float scale);
+    void _SET_PTFX_ASSET_NEXT_CALL(char* name);
+}
+
+namespace STREAMING {
+    void REQUEST_MODEL(Hash model);
+    BOOL HAS_MODEL_LOADED(Hash model);
+    void SET_MODEL_AS_NO_LONGER_NEEDED(Hash model);
+    void REQUEST_NAMED_PTFX_ASSET(char* fxName);
+    BOOL HAS_NAMED_PTFX_ASSET_LOADED(char* fxName);
+    void _REMOVE_NAMED_PTFX_ASSET(char* fxName);
+}
+
+namespace DECISIONEVENT {
+    Any ADD_SHOCKING_EVENT_FOR_ENTITY(Any p0, Any p1, float p2);
+}
+
+namespace GAMEPLAY {
+    BOOL GET_GROUND_Z_FOR_3D_COORD(float x, float y, float z, float* groundZ, BOOL unk);
+    BOOL IS_PREV_WEATHER_TYPE(char* weatherType);
+    void SET_WIND_SPEED(float speed);
+}
@@ -0,0 +1,44 @@
+#pragma once
+// Headless build: the ScriptHookV SDK types the mod uses, laid out like the
+// SDK's (Vector3 keeps its 8-byte padded members).
+#include "windows.h"
+
+typedef DWORD Void;
+typedef DWORD Any;
+typedef DWORD uint;
+typedef DWORD Hash;
+typedef int Entity;
+typedef int Player;
+typedef int FireId;
+typedef int Ped;
+typedef int Vehicle;
+typedef int Cam;
+typedef int CarGenerator;
+typedef int Group;
+typedef int Train;
+typedef int Pickup;
+typedef int Object;
+typedef int Weapon;
+typedef int Interior;
+typedef int Blip;
+typedef int Texture;
+typedef int TextureDict;
+typedef int CoverPoint;
+typedef int Camera;
+typedef int TaskSequence;
+typedef int ColourIndex;
+typedef int Sphere;
+typedef int ScrHandle;
+
+#pragma pack(push, 1)
+typedef struct {
+    float x;
+    DWORD _paddingx;
+    float y;
+    DWORD _paddingy;
+    float z;
+    DWORD _paddingz;
+} Vector3;
+#pragma pack(pop)
+
+static_assert(sizeof(Vector3) == 24, "Vector3 must match the SDK layout");
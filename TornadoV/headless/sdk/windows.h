@@ -0,0 +1,21 @@
+#pragma once
+// Headless build: the handful of Win32 types the mod's headers name.
+// Nothing here is implemented; code that calls Win32 stays out of the
+// headless targets or sits behind #ifdef _WIN32.
+#include <cstdint>
+
+typedef uint32_t DWORD;
+typedef uint16_t WORD;
+typedef uint8_t BYTE;
+typedef int BOOL;
+typedef void* HANDLE;
+typedef void* HMODULE;
+typedef void* LPVOID;
+typedef const char* LPCSTR;
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Minimal self-registering test cases for the headless build.
+// TV_TEST(Suite_Name) defines a case; TestMain runs every case whose name
+// starts with the filter given on the command line (ctest passes the suite).
+namespace tvtest {
+
+struct TestCase {
+    const char* name;
+    void (*run)();
+};
+
+std::vector<TestCase>& Registry();
+void Fail(const char* file, int line, const std::string& message);
+
+inline std::string Show(const std::string& value) { return "\"" + value + "\""; }
+inline std::string Show(const char* value) { return Show(std::string(value)); }
+template <typename T>
+std::string Show(const T& value) { return std::to_string(value); }
+
+struct Registrar {
+    Registrar(const char* name, void (*run)()) { Registry().push_back({ name, run }); }
+};
+
+} // namespace tvtest
+
+#define TV_TEST(name)                                            \
+    static void name();                                          \
+    static tvtest::Registrar name##_registrar(#name, name);      \
+    static void name()
+
+#define TV_CHECK(cond)                                                       \
+    do {                                                                     \
+        if (!(cond)) tvtest::Fail(__FILE__, __LINE__, "TV_CHECK(" #cond ")"); \
+    } while (0)
+
+#define TV_CHECK_EQ(a, b)                                                                     \
+    do {                                                                                      \
+        auto va_ = (a);                                                                       \
+        auto vb_ = (b);                                                                       \
+        if (!(va_ == vb_))                                                                    \
+            tvtest::Fail(__FILE__, __LINE__, "TV_CHECK_EQ(" #a ", " #b "): " +                \
+                tvtest::Show(va_) + " != " + tvtest::Show(vb_));                              \
+    } while (0)
@@ -0,0 +1,112 @@
+#include "Check.h"
+#include "EntityGrid.h"
+#include "EntityClaims.h"
+#include "MathEx.h"
+#include <random>
+
+namespace {
+
+Vector3 At(float x, float y, float z = 0.0f) {
+    return { x, 0, y, 0, z, 0 };
+}
+
+struct Disc {
+    int owner;
+    Vector3 center;
+    float radius;
+};
+
+// Closest reaching center wins; on a tie the disc claimed first keeps it
+int BruteForceOwner(const Vector3& position, const std::vector<Disc>& discs) {
+    int owner = -1;
+    float best = 0.0f;
+    for (const Disc& disc : discs) {
+        float dist = MathEx::Distance2D(position, disc.center);
+        if (dist > disc.radius) continue;
+        if (owner == -1 || dist < best) {
+            owner = disc.owner;
+            best = dist;
+        }
+    }
+    return owner;
+}
+
+} // namespace
+
+TV_TEST(Claims_GridOwnersMatchBruteForce) {
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> coord(-400.0f, 400.0f);
+    std::uniform_real_distribution<float> radius(20.0f, 250.0f);
+
+    EntityGrid grid;
+    for (int round = 0; round < 50; round++) {
+        grid.Clear();
+        for (int i = 0; i < 600; i++) {
+            grid.Insert(1 + i, At(coord(rng), coord(rng), coord(rng)), (EntityKind)(i % 3));
+        }
+        grid.Build();
+
+        std::vector<Disc> discs;
+        int count = 1 + round % 5;
+        for (int v = 0; v < count; v++) {
+            discs.push_back({ 10 + v, At(coord(rng), coord(rng)), radius(rng) });
+            grid.ClaimOwners(discs.back().owner, discs.back().center, discs.back().radius);
+        }
+
+        for (int i = 0; i < grid.GetCount(); i++) {
+            TV_CHECK_EQ(grid.Owner(i), BruteForceOwner(grid.Get(i).position, discs));
+        }
+    }
+}
+
+TV_TEST(Claims_GridOwnersStartUnclaimed) {
+    EntityGrid grid;
+    grid.Insert(1, At(0.0f, 0.0f), EntityKind::Ped);
+    grid.Insert(2, At(50.0f, 0.0f), EntityKind::Ped);
+    grid.Insert(3, At(500.0f, 0.0f), EntityKind::Ped);
+    grid.Build();
+
+    grid.ClaimOwners(1, At(-10.0f, 0.0f), 100.0f);
+    grid.ClaimOwners(2, At(60.0f, 0.0f), 100.0f);
+    TV_CHECK_EQ(grid.Owner(0), 1);
+    TV_CHECK_EQ(grid.Owner(1), 2); // Closer to the second center
+    TV_CHECK_EQ(grid.Owner(2), -1); // Reached by neither
+
+    // Exactly halfway: the first claim stands
+    grid.ClaimOwners(3, At(450.0f, 0.0f), 60.0f);
+    grid.ClaimOwners(4, At(550.0f, 0.0f), 60.0f);
+    TV_CHECK_EQ(grid.Owner(2), 3);
+
+    // The next scan tick refills the grid and every entity is up for grabs again
+    grid.Clear();
+    grid.Insert(1, At(0.0f, 0.0f), EntityKind::Ped);
+    grid.Insert(3, At(500.0f, 0.0f), EntityKind::Ped);
+    grid.Build();
+    TV_CHECK_EQ(grid.Owner(0), -1);
+    TV_CHECK_EQ(grid.Owner(1), -1);
+}
+
+TV_TEST(Claims_ClaimAndRelease) {
+    EntityClaims claims;
+    TV_CHECK_EQ(claims.OwnerOf(100), EntityClaims::NoOwner);
+
+    claims.Claim(100, 1);
+    claims.Claim(200, 1);
+    TV_CHECK_EQ(claims.OwnerOf(100), 1);
+    TV_CHECK_EQ(claims.Size(), 2);
+
+    // A later claim takes the entity over, and the old owner can no longer drop it
+    claims.Claim(100, 2);
+    TV_CHECK_EQ(claims.OwnerOf(100), 2);
+    claims.Release(100, 1);
+    TV_CHECK_EQ(claims.OwnerOf(100), 2);
+
+    claims.Release(100, 2);
+    TV_CHECK_EQ(claims.OwnerOf(100), EntityClaims::NoOwner);
+    claims.Release(300, 1); // Never claimed
+    TV_CHECK_EQ(claims.Size(), 1);
+
+    claims.Clear();
+    TV_CHECK_EQ(claims.Size(), 0);
+    TV_CHECK_EQ(claims.OwnerOf(200), EntityClaims::NoOwner);
+}
@@ -0,0 +1,122 @@
+#include "Check.h"
+#include "ConfigWatcher.h"
+#include "HeadlessShell.h"
+#include "IniHelper.h"
+#include "IniStore.h"
+#include "tinyxml2/tinyxml2.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Every required setting at its default, with the vortex radius swapped in
+std::string FullIni(const std::string& radius) {
+    std::string text;
+    std::string section;
+    for (const IniHelper::IniSetting& setting : IniHelper::RequiredSettings()) {
+        if (setting.section != section) {
+            section = setting.section;
+            text += "[" + section + "]\n";
+        }
+        text += setting.key + " = " + (setting.key == "VortexRadius" ? radius : setting.defaultValue) + "\n";
+    }
+    return text;
+}
+
+const char* INI_V1 = "[Vortex]\nRadius = 9.4\n";
+const char* XML_V1 = "<MenuConfig><Layout><X value=\"0.15\" /></Layout></MenuConfig>\n";
+
+// Written beside the target and renamed in, the way the mod and most editors save
+void Save(const fs::path& path, const std::string& text) {
+    fs::path temp = path;
+    temp += ".tmp";
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        file << text;
+    }
+    fs::rename(temp, path);
+}
+
+// The watcher settles for 150 ms after a change and polls every 200 ms
+template <typename T, typename Take>
+std::shared_ptr<T> WaitFor(Take take, int timeoutMs = 3000) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (std::shared_ptr<T> taken = take()) return taken;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TV_TEST(ConfigWatcher_HashContent) {
+    TV_CHECK_EQ(ConfigWatcher::HashContent(""), 14695981039346656037ULL);
+    TV_CHECK_EQ(ConfigWatcher::HashContent(INI_V1), ConfigWatcher::HashContent(std::string(INI_V1)));
+    TV_CHECK(ConfigWatcher::HashContent("Radius = 9.4") != ConfigWatcher::HashContent("Radius = 9.5"));
+    TV_CHECK(ConfigWatcher::HashContent("ab") != ConfigWatcher::HashContent("ba"));
+}
+
+// One case, since the watcher thread can only be started once per process
+TV_TEST(ConfigWatcher_ReloadsEditedFiles) {
+    fs::path dir = fs::temp_directory_path() / "tornadov_watch_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    fs::path ini = dir / "TornadoV.ini";
+    fs::path xml = dir / "menu_config.xml";
+    Save(ini, FullIni("9.4"));
+    Save(xml, XML_V1);
+
+    ConfigWatcher::Start(ini.string(), xml.string());
+    std::this_thread::sleep_for(std::chrono::milliseconds(200)); // The watch is set up on the thread
+
+    // An outside edit is parsed and handed over once
+    Save(ini, FullIni("12.5"));
+    auto store = WaitFor<const IniStore>(ConfigWatcher::TakeIni);
+    TV_CHECK(store != nullptr);
+    if (store) TV_CHECK_EQ(store->GetFloat("Vortex", "VortexRadius", 0.0f), 12.5f);
+    TV_CHECK(ConfigWatcher::TakeIni() == nullptr);
+
+    // A file caught mid-save lacks required settings and is not handed over
+    std::string whole = FullIni("40");
+    Save(ini, whole.substr(0, whole.size() / 2));
+    TV_CHECK(WaitFor<const IniStore>(ConfigWatcher::TakeIni, 800) == nullptr);
+
+    // Our own save is recognised by its hash and ignored
+    std::string own = FullIni("20");
+    ConfigWatcher::NoteContent(ConfigFile::Ini, own);
+    Save(ini, own);
+    TV_CHECK(WaitFor<const IniStore>(ConfigWatcher::TakeIni, 800) == nullptr);
+
+    // A broken XML edit keeps the current document
+    Save(xml, "<MenuConfig><Layout>");
+    TV_CHECK(WaitFor<tinyxml2::XMLDocument>(ConfigWatcher::TakeXml, 800) == nullptr);
+
+    // Apply() adopts both snapshots on the calling thread and reloads the menu
+    Save(ini, FullIni("30"));
+    Save(xml, "<MenuConfig><Layout><X value=\"0.25\" /></Layout></MenuConfig>\n");
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+    while ((HeadlessShell::iniReloads == 0 || HeadlessShell::xmlReloads == 0) && std::chrono::steady_clock::now() < deadline) {
+        ConfigWatcher::Apply();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    TV_CHECK_EQ(HeadlessShell::iniReloads, 1);
+    TV_CHECK_EQ(HeadlessShell::xmlReloads, 1);
+    TV_CHECK_EQ(IniHelper::GetValue("Vortex", "VortexRadius", 0.0f), 30.0f);
+    TV_CHECK_EQ(IniHelper::GetValue("KeyBinds", "ToggleMenu", ""), std::string("F5"));
+    TV_CHECK_EQ(IniHelper::GetValue("VortexAdvanced", "PropPoolSize", 0), 512);
+    TV_CHECK_EQ(IniHelper::GetValue("Other", "AddBlip", false), true);
+    TV_CHECK(HeadlessShell::adoptedXml != nullptr);
+    if (HeadlessShell::adoptedXml) {
+        tinyxml2::XMLElement* x = HeadlessShell::adoptedXml->RootElement()->FirstChildElement("Layout")->FirstChildElement("X");
+        TV_CHECK_EQ(std::string(x->Attribute("value")), std::string("0.25"));
+    }
+
+    ConfigWatcher::Stop();
+    std::this_thread::sleep_for(std::chrono::milliseconds(300)); // Let the detached thread see it
+    fs::remove_all(dir);
+}
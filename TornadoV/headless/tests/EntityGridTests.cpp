@@ -0,0 +1,116 @@
+#include "Check.h"
+#include "EntityGrid.h"
+#include "MathEx.h"
+#include <algorithm>
+#include <random>
+
+namespace {
+
+Vector3 At(float x, float y, float z = 0.0f) {
+    return { x, 0, y, 0, z, 0 };
+}
+
+std::vector<int> BruteForce(const EntityGrid& grid, const Vector3& center, float radius) {
+    std::vector<int> result;
+    for (int i = 0; i < grid.GetCount(); i++) {
+        if (MathEx::Distance2D(grid.Get(i).position, center) <= radius)
+            result.push_back(i);
+    }
+    return result;
+}
+
+void FillRandom(EntityGrid& grid, std::mt19937& rng, int count, float extent) {
+    std::uniform_real_distribution<float> coord(-extent, extent);
+    std::uniform_real_distribution<float> height(-50.0f, 400.0f);
+    grid.Clear();
+    for (int i = 0; i < count; i++) {
+        grid.Insert(1000 + i, At(coord(rng), coord(rng), height(rng)), (EntityKind)(i % 3));
+    }
+    grid.Build();
+}
+
+} // namespace
+
+TV_TEST(EntityGrid_QueryMatchesBruteForce) {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(-3000.0f, 3000.0f);
+    std::uniform_real_distribution<float> radius(0.0f, 600.0f);
+
+    EntityGrid grid;
+    std::vector<int> result;
+    for (int round = 0; round < 20; round++) {
+        FillRandom(grid, rng, 3000, 3000.0f);
+        for (int q = 0; q < 100; q++) {
+            Vector3 center = At(coord(rng), coord(rng));
+            float r = radius(rng);
+
+            result.clear();
+            grid.Query(center, r, result);
+            TV_CHECK(result == BruteForce(grid, center, r));
+        }
+    }
+}
+
+TV_TEST(EntityGrid_QueryWiderThanTable) {
+    // Past BucketCount cells the grid falls back to a linear scan
+    std::mt19937 rng(99);
+    EntityGrid grid;
+    FillRandom(grid, rng, 2000, 5000.0f);
+
+    std::vector<int> result;
+    Vector3 center = At(120.0f, -340.0f);
+    grid.Query(center, 4000.0f, result);
+    TV_CHECK(result == BruteForce(grid, center, 4000.0f));
+}
+
+TV_TEST(EntityGrid_QueryAppendsInInsertionOrder) {
+    EntityGrid grid;
+    std::mt19937 rng(7);
+    FillRandom(grid, rng, 500, 200.0f);
+
+    // Existing contents are kept and the new indices are sorted after them
+    std::vector<int> result = { -1, -2 };
+    grid.Query(At(0.0f, 0.0f), 150.0f, result);
+    TV_CHECK(result.size() > 2);
+    TV_CHECK_EQ(result[0], -1);
+    TV_CHECK_EQ(result[1], -2);
+    TV_CHECK(std::is_sorted(result.begin() + 2, result.end()));
+    TV_CHECK(std::adjacent_find(result.begin() + 2, result.end()) == result.end());
+}
+
+TV_TEST(EntityGrid_CellEdgesAndNegativeCoords) {
+    EntityGrid grid;
+    // On cell boundaries, either side of zero, and exactly on the radius
+    const float points[][2] = {
+        { 0.0f, 0.0f }, { 32.0f, 0.0f }, { -32.0f, 0.0f }, { 0.0f, -32.0f },
+        { 31.999f, 31.999f }, { -0.001f, -0.001f }, { 64.0f, 64.0f }, { -64.0f, 64.0f }
+    };
+    for (int i = 0; i < 8; i++) {
+        grid.Insert(i + 1, At(points[i][0], points[i][1]), EntityKind::Object);
+    }
+    grid.Build();
+
+    std::vector<int> result;
+    for (float r : { 0.0f, 1.0f, 32.0f, 45.26f, 90.6f }) {
+        for (const auto& p : points) {
+            result.clear();
+            grid.Query(At(p[0], p[1]), r, result);
+            TV_CHECK(result == BruteForce(grid, At(p[0], p[1]), r));
+        }
+    }
+}
+
+TV_TEST(EntityGrid_ManyQueriesBetweenBuilds) {
+    // Bucket visit stamps must not leak from one query into the next
+    EntityGrid grid;
+    std::mt19937 rng(42);
+    FillRandom(grid, rng, 1000, 1000.0f);
+
+    std::vector<int> result;
+    for (int q = 0; q < 5000; q++) {
+        Vector3 center = At((float)(q % 50) * 40.0f - 1000.0f, (float)(q / 50) * 20.0f - 1000.0f);
+        result.clear();
+        grid.Query(center, 90.0f, result);
+        TV_CHECK(result == BruteForce(grid, center, 90.0f));
+    }
+}
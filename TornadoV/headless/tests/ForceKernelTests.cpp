@@ -0,0 +1,94 @@
+#include "Check.h"
+#include "ForceKernel.h"
+#include <cmath>
+#include <cstring>
+#include <random>
+
+namespace {
+
+Vector3 At(float x, float y, float z) {
+    return { x, 0, y, 0, z, 0 };
+}
+
+bool SameBits(const std::vector<float>& a, const std::vector<float>& b) {
+    return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0);
+}
+
+bool SameOutputs(const ForceBatch& a, const ForceBatch& b) {
+    return a.valid == b.valid &&
+        SameBits(a.dirX, b.dirX) && SameBits(a.dirY, b.dirY) && SameBits(a.dirZ, b.dirZ) &&
+        SameBits(a.upX, b.upX) && SameBits(a.upY, b.upY) && SameBits(a.upZ, b.upZ) &&
+        SameBits(a.tanX, b.tanX) && SameBits(a.tanY, b.tanY) && SameBits(a.tanZ, b.tanZ);
+}
+
+// Runs both paths on copies of batch and compares every output bit for bit
+bool KernelMatchesScalar(const ForceBatch& batch, const Vector3& core) {
+    ForceBatch vectorized = batch;
+    ForceBatch scalar = batch;
+    ForceKernel::Compute(vectorized, core);
+    ForceKernel::ComputeScalar(scalar, core);
+    return SameOutputs(vectorized, scalar);
+}
+
+} // namespace
+
+TV_TEST(ForceKernel_MatchesScalarOnRandomBatches) {
+    std::mt19937 rng(2024);
+    std::uniform_real_distribution<float> offset(-120.0f, 120.0f);
+    std::uniform_real_distribution<float> height(-20.0f, 300.0f);
+    std::uniform_real_distribution<float> bias(-5.0f, 5.0f);
+    std::uniform_real_distribution<float> world(-4000.0f, 4000.0f);
+
+    for (int round = 0; round < 2000; round++) {
+        Vector3 core = At(world(rng), world(rng), height(rng));
+        int count = round % 41; // Covers empty batches and every SSE tail length
+
+        ForceBatch batch;
+        for (int i = 0; i < count; i++) {
+            Vector3 pos = At(core.x + offset(rng), core.y + offset(rng), height(rng));
+            batch.Push(100 + i, pos, bias(rng), bias(rng), i == 0, 0.0f);
+        }
+        TV_CHECK(KernelMatchesScalar(batch, core));
+    }
+}
+
+TV_TEST(ForceKernel_MatchesScalarOnEdgeCases) {
+    Vector3 core = At(10.0f, -20.0f, 5.0f);
+
+    ForceBatch batch;
+    // Exactly on the biased core: degenerate pull direction
+    batch.Push(1, At(10.0f, -20.0f, 30.0f), 0.0f, 0.0f, false, 0.0f);
+    batch.Push(2, At(11.0f, -19.0f, 30.0f), 1.0f, 1.0f, false, 0.0f);
+    // Just either side of the 0.0001 validity threshold
+    batch.Push(3, At(10.00005f, -20.0f, 0.0f), 0.0f, 0.0f, false, 0.0f);
+    batch.Push(4, At(10.001f, -20.0f, 0.0f), 0.0f, 0.0f, false, 0.0f);
+    // Directly above the lift target and far away
+    batch.Push(5, At(10.0f, -20.0f, 1005.0f), 0.0f, 0.0f, true, 0.0f);
+    batch.Push(6, At(9000.0f, -9000.0f, -100.0f), -3.0f, 2.0f, false, 0.0f);
+    // Negative zeros in the inputs
+    batch.Push(7, At(-0.0f, -0.0f, -0.0f), -0.0f, -0.0f, false, 0.0f);
+    batch.Push(8, At(10.0f, -25.0f, 5.0f), 0.0f, -0.0f, false, 0.0f);
+    batch.Push(9, At(1e-6f, 1e-6f, 0.0f), 0.0f, 0.0f, false, 0.0f);
+
+    TV_CHECK(KernelMatchesScalar(batch, core));
+    TV_CHECK(KernelMatchesScalar(batch, At(-0.0f, -0.0f, -0.0f)));
+    TV_CHECK(KernelMatchesScalar(batch, At(0.0f, 0.0f, 0.0f)));
+}
+
+TV_TEST(ForceKernel_Directions) {
+    ForceBatch batch;
+    batch.Push(1, At(10.0f, 0.0f, 0.0f), 0.0f, 0.0f, false, 10.0f);
+    batch.Push(2, At(0.0f, 0.0f, 7.0f), 0.0f, 0.0f, false, 0.0f);
+    ForceKernel::Compute(batch, At(0.0f, 0.0f, 0.0f));
+
+    // East of the core: pulled west, tangent is cross(dir, up)
+    TV_CHECK_EQ(batch.valid[0], 1);
+    TV_CHECK(batch.dirX[0] == -1.0f && batch.dirY[0] == 0.0f && batch.dirZ[0] == 0.0f);
+    TV_CHECK(batch.tanX[0] == 0.0f && batch.tanY[0] == 1.0f && batch.tanZ[0] == 0.0f);
+    TV_CHECK(std::fabs(std::sqrt(batch.upX[0] * batch.upX[0] + batch.upZ[0] * batch.upZ[0]) - 1.0f) < 1e-6f);
+
+    // On the core: no pull, the zero vector stays zero
+    TV_CHECK_EQ(batch.valid[1], 0);
+    TV_CHECK(batch.dirX[1] == 0.0f && batch.dirY[1] == 0.0f && batch.dirZ[1] == 0.0f);
+    TV_CHECK(batch.upZ[1] == 1.0f);
+}
@@ -0,0 +1,163 @@
+#include "Check.h"
+#include "IniStore.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+const char* SAMPLE =
+    "; TornadoV settings\r\n"
+    "[Vortex]\r\n"
+    "Radius = 9.4\r\n"
+    "Layers=48\r\n"
+    "  ParticleName = \"ent_amb_smoke_foundry\"  \r\n"
+    "Radius = 99\r\n"
+    "\r\n"
+    "# menu\r\n"
+    "[Menu]\r\n"
+    "Notifications = true\r\n"
+    "SpawnInStorm = 0\r\n"
+    "Hotkey = F5\r\n";
+
+std::string ReadFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+std::string TempPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+} // namespace
+
+TV_TEST(IniStore_SerializeUntouchedIsVerbatim) {
+    IniStore store;
+    store.Parse(SAMPLE);
+    TV_CHECK_EQ(store.Serialize(), std::string(SAMPLE));
+    TV_CHECK(!store.IsDirty());
+
+    // LF files and a BOM survive too
+    std::string lf = "\xEF\xBB\xBF[A]\nx = 1\n";
+    store.Parse(lf);
+    TV_CHECK_EQ(store.Serialize(), lf);
+}
+
+TV_TEST(IniStore_TypedGetters) {
+    IniStore store;
+    store.Parse(SAMPLE);
+
+    TV_CHECK_EQ(store.GetFloat("Vortex", "Radius", 0.0f), 9.4f);
+    TV_CHECK_EQ(store.GetDouble("Vortex", "Radius", 0.0), 9.4);
+    TV_CHECK_EQ(store.GetInt("Vortex", "Layers", 0), 48);
+    TV_CHECK_EQ(store.GetString("Vortex", "ParticleName", ""), std::string("ent_amb_smoke_foundry"));
+    TV_CHECK(store.GetBool("Menu", "Notifications", false));
+    TV_CHECK(!store.GetBool("Menu", "SpawnInStorm", true));
+
+    // Not a number, missing, or missing section: the default comes back
+    TV_CHECK_EQ(store.GetInt("Menu", "Hotkey", -1), -1);
+    TV_CHECK_EQ(store.GetInt("Menu", "Missing", 7), 7);
+    TV_CHECK_EQ(store.GetString("Nowhere", "Radius", "x"), std::string("x"));
+}
+
+TV_TEST(IniStore_LookupsIgnoreCase) {
+    IniStore store;
+    store.Parse(SAMPLE);
+    TV_CHECK(store.Has("vortex", "RADIUS"));
+    TV_CHECK_EQ(store.GetInt("MENU", "spawninstorm", 1), 0);
+}
+
+TV_TEST(IniStore_FirstDuplicateWins) {
+    IniStore store;
+    store.Parse(SAMPLE);
+    TV_CHECK_EQ(store.GetFloat("Vortex", "Radius", 0.0f), 9.4f);
+
+    // The repeat is kept as text and never rewritten
+    store.Set("Vortex", "Radius", "12");
+    std::string text = store.Serialize();
+    TV_CHECK(text.find("Radius = 12\r\n") != std::string::npos);
+    TV_CHECK(text.find("Radius = 99\r\n") != std::string::npos);
+}
+
+TV_TEST(IniStore_SetKeepsLayout) {
+    IniStore store;
+    store.Parse(SAMPLE);
+
+    TV_CHECK(!store.Set("Vortex", "Layers", "48"));
+    TV_CHECK(!store.IsDirty());
+
+    TV_CHECK(store.Set("Vortex", "Layers", "64"));
+    TV_CHECK(store.Set("Menu", "NewKey", "on"));
+    TV_CHECK(store.Set("Audio", "Volume", "0.5"));
+    TV_CHECK(store.IsDirty());
+    TV_CHECK_EQ(store.GetInt("Vortex", "Layers", 0), 64);
+    TV_CHECK_EQ(store.GetFloat("Audio", "Volume", 0.0f), 0.5f);
+
+    std::string expected =
+        "; TornadoV settings\r\n"
+        "[Vortex]\r\n"
+        "Radius = 9.4\r\n"
+        "Layers=64\r\n"
+        "  ParticleName = \"ent_amb_smoke_foundry\"  \r\n"
+        "Radius = 99\r\n"
+        "\r\n"
+        "# menu\r\n"
+        "[Menu]\r\n"
+        "Notifications = true\r\n"
+        "SpawnInStorm = 0\r\n"
+        "Hotkey = F5\r\n"
+        "NewKey = on\r\n"
+        "\r\n"
+        "[Audio]\r\n"
+        "Volume = 0.5\r\n";
+    TV_CHECK_EQ(store.Serialize(), expected);
+}
+
+TV_TEST(IniStore_FlushAndReload) {
+    std::string path = TempPath("tornadov_inistore_test.ini");
+    std::remove(path.c_str());
+
+    IniStore store;
+    store.Parse(SAMPLE);
+    TV_CHECK(store.Flush(path)); // Clean, so nothing is written
+    TV_CHECK(!std::filesystem::exists(path));
+
+    store.Set("Vortex", "Radius", "11.5");
+    store.Set("Menu", "Hotkey", "F6");
+    TV_CHECK(store.Flush(path));
+    TV_CHECK(!store.IsDirty());
+    TV_CHECK(!std::filesystem::exists(path + ".tmp"));
+    TV_CHECK_EQ(ReadFile(path), store.Serialize());
+
+    IniStore reloaded;
+    TV_CHECK(reloaded.Load(path));
+    TV_CHECK_EQ(reloaded.Size(), store.Size());
+    TV_CHECK_EQ(reloaded.GetFloat("Vortex", "Radius", 0.0f), 11.5f);
+    TV_CHECK_EQ(reloaded.GetString("Menu", "Hotkey", ""), std::string("F6"));
+    TV_CHECK_EQ(reloaded.Serialize(), store.Serialize());
+
+    std::remove(path.c_str());
+    TV_CHECK(!reloaded.Load(path));
+}
+
+TV_TEST(IniStore_FlushWritesGivenText) {
+    std::string path = TempPath("tornadov_inistore_text_test.ini");
+    std::remove(path.c_str());
+
+    IniStore store;
+    store.Parse(SAMPLE);
+    store.Set("Vortex", "Radius", "12");
+    std::string text = store.Serialize();
+    TV_CHECK(store.Flush(path, text));
+    TV_CHECK(!store.IsDirty());
+    TV_CHECK_EQ(ReadFile(path), text);
+
+    // Clean stores skip the write even when handed text
+    TV_CHECK(store.Flush(path, "[Broken"));
+    TV_CHECK_EQ(ReadFile(path), text);
+
+    std::remove(path.c_str());
+}
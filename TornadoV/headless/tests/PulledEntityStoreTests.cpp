@@ -0,0 +1,48 @@
+#include "Check.h"
+#include "PulledEntityStore.h"
+#include <random>
+#include <unordered_map>
+
+TV_TEST(PulledEntityStore_MatchesMapUnderChurn) {
+    std::mt19937 rng(7);
+    // Pool-style handles: small index plus a generation byte, so they cluster
+    std::uniform_int_distribution<int> index(0, 2047);
+    std::uniform_int_distribution<int> generation(0, 3);
+    std::uniform_int_distribution<int> op(0, 9);
+
+    PulledEntityStore store;
+    std::unordered_map<Entity, float> expected;
+
+    for (int step = 0; step < 20000; step++) {
+        Entity handle = (index(rng) << 8) | generation(rng);
+        if (op(rng) < 6) {
+            if (store.Contains(handle)) continue;
+            store.Add(handle, (float)handle, 0.0f, false, 0);
+            expected[handle] = (float)handle;
+        } else {
+            TV_CHECK_EQ(store.Remove(handle), expected.erase(handle) != 0);
+        }
+
+        if (step % 1000 == 0) {
+            TV_CHECK_EQ(store.Size(), (int)expected.size());
+            for (const auto& pair : expected) {
+                int slot = store.Find(pair.first);
+                TV_CHECK(slot != -1);
+                if (slot != -1) TV_CHECK_EQ(store.XBias(slot), pair.second);
+            }
+        }
+    }
+
+    // Grows well past the initial table, then empties out again
+    for (int i = 0; i < 3000; i++) {
+        Entity handle = 0x100000 + i;
+        store.Add(handle, 0.0f, 0.0f, false, 0);
+        expected[handle] = 0.0f;
+    }
+    TV_CHECK_EQ(store.Size(), (int)expected.size());
+    for (const auto& pair : expected) {
+        TV_CHECK(store.Remove(pair.first));
+    }
+    TV_CHECK_EQ(store.Size(), 0);
+    TV_CHECK(!store.Contains(0x100000));
+}
@@ -0,0 +1,169 @@
+#include "Check.h"
+#include "FakeWorld.h"
+#include "TornadoFactory.h"
+#include "AssetCache.h"
+#include "FrameBudget.h"
+#include "MathEx.h"
+#include <string>
+
+namespace {
+
+const float FRAME_TIME = 1.0f / 30.0f;
+const float FRAME_BUDGET_US = 50000.0f; // Generous, so a slow CI box doesn't change what gets done
+
+Vector3 At(float x, float y, float z = 0.0f) {
+    return { x, 0, y, 0, z, 0 };
+}
+
+// Resets the world before the factory is built, so every test starts clean
+TornadoSettings FreshWorld() {
+    FakeWorld::Get().Reset();
+    TornadoSettings settings;
+    settings.spawnInStorm = false;
+    settings.followPlayer = false;
+    return settings;
+}
+
+// One pass of script.cpp's update(): step the game, then run the mod's frame
+struct Simulation {
+    TornadoSettings settings;
+    TornadoFactory factory;
+
+    Simulation() : settings(FreshWorld()), factory(settings) {}
+
+    void Frame() {
+        FakeWorld& world = FakeWorld::Get();
+        world.Step(FRAME_TIME);
+        FrameContext frame = world.CaptureFrame();
+        FrameBudget budget(FRAME_BUDGET_US);
+        AssetCache::Get().Update();
+        factory.OnUpdate(frame, settings, budget);
+    }
+
+    void Run(int frames) {
+        for (int i = 0; i < frames; i++) Frame();
+    }
+
+    // The factory refuses spawns during its cooldown after the game starts
+    TornadoVortex* SpawnAndBuild(const Vector3& position) {
+        Run(90);
+        TornadoVortex* vortex = factory.CreateVortex(position);
+        for (int i = 0; vortex && !vortex->IsBuilt() && i < 600; i++) Frame();
+        return vortex;
+    }
+};
+
+} // namespace
+
+TV_TEST(Simulation_FactoryBuildsVortex) {
+    Simulation sim;
+    FakeWorld& world = FakeWorld::Get();
+
+    TornadoVortex* vortex = sim.SpawnAndBuild(At(0.0f, 80.0f));
+    TV_CHECK(vortex != nullptr);
+    TV_CHECK(vortex->IsBuilt());
+    TV_CHECK_EQ(sim.factory.GetActiveVortexCount(), 1);
+
+    TV_CHECK(vortex->GetParticleCount() > 0);
+    TV_CHECK(world.Count(FakeWorld::Kind::Object) > 0);
+    TV_CHECK(world.GetEffectCount() > 0);
+    TV_CHECK_EQ(world.GetBlipCount(), 1);
+
+    TV_CHECK_EQ((int)world.notifications.size(), 1);
+    TV_CHECK(world.notifications[0].find("Tornado spawned") != std::string::npos);
+}
+
+TV_TEST(Simulation_PullsNearbyPeds) {
+    Simulation sim;
+    FakeWorld& world = FakeWorld::Get();
+    sim.settings.movementEnabled = false;
+
+    Vector3 center = At(0.0f, 80.0f);
+    std::vector<Entity> peds;
+    for (int i = 0; i < 16; i++) {
+        peds.push_back(world.Spawn(FakeWorld::Kind::Ped, At(center.x + (i % 4) * 6.0f - 9.0f, center.y + (i / 4) * 6.0f - 9.0f)));
+    }
+    Entity farPed = world.Spawn(FakeWorld::Kind::Ped, At(center.x + 400.0f, center.y));
+
+    TornadoVortex* vortex = sim.SpawnAndBuild(center);
+    TV_CHECK(vortex != nullptr);
+    sim.Run(120);
+
+    int lifted = 0;
+    for (Entity ped : peds) {
+        if (world.Find(ped)->position.z > world.GetGroundZ() + 1.0f) lifted++;
+    }
+    TV_CHECK(lifted > 0);
+
+    // Out of range, so never touched
+    FakeWorld::Body* far = world.Find(farPed);
+    TV_CHECK(far->position.z == world.GetGroundZ());
+    TV_CHECK(far->ragdollUntil == 0);
+}
+
+TV_TEST(Simulation_RemoveAllDrainsOverFrames) {
+    Simulation sim;
+    FakeWorld& world = FakeWorld::Get();
+
+    TV_CHECK(sim.SpawnAndBuild(At(0.0f, 80.0f)) != nullptr);
+    int effects = world.GetEffectCount();
+    TV_CHECK(effects > 0);
+
+    sim.factory.RemoveAll();
+    TV_CHECK_EQ(sim.factory.GetActiveVortexCount(), 0);
+    TV_CHECK(sim.factory.IsTearingDown());
+    TV_CHECK_EQ(world.GetBlipCount(), 0);
+
+    // The funnel fades out over several frames, not in the RemoveAll call
+    sim.Frame();
+    TV_CHECK(world.GetEffectCount() > 0);
+
+    for (int i = 0; sim.factory.IsTearingDown() && i < 600; i++) sim.Frame();
+    TV_CHECK(!sim.factory.IsTearingDown());
+    TV_CHECK_EQ(world.GetEffectCount(), 0);
+
+    // Props that outlive the funnel are parked frozen under the map for the next spawn
+    int objects[1024];
+    int count = world.Collect(FakeWorld::Kind::Object, objects, 1024);
+    TV_CHECK(count <= sim.settings.propPoolSize);
+    for (int i = 0; i < count; i++) {
+        FakeWorld::Body* prop = world.Find(objects[i]);
+        TV_CHECK(prop->frozen);
+        TV_CHECK(prop->position.z < world.GetGroundZ());
+    }
+}
+
+TV_TEST(Simulation_RemoveAllCollectsShapeTests) {
+    Simulation sim;
+    FakeWorld& world = FakeWorld::Get();
+    sim.settings.movementEnabled = false;
+
+    Vector3 center = At(0.0f, 80.0f);
+    for (int i = 0; i < 30; i++) {
+        world.Spawn(FakeWorld::Kind::Ped, At(center.x + (i % 6) * 5.0f - 12.0f, center.y + (i / 6) * 5.0f - 12.0f));
+    }
+    TV_CHECK(sim.SpawnAndBuild(center) != nullptr);
+
+    // Stop on a frame that left shelter probes in flight
+    for (int i = 0; world.GetPendingShapeTestCount() == 0 && i < 300; i++) sim.Frame();
+    TV_CHECK(world.GetPendingShapeTestCount() > 0);
+
+    sim.factory.RemoveAll();
+    for (int i = 0; i < 5; i++) sim.Frame();
+    TV_CHECK_EQ(world.GetPendingShapeTestCount(), 0);
+}
+
+TV_TEST(Simulation_DisposeReleasesAssets) {
+    FakeWorld& world = FakeWorld::Get();
+    {
+        Simulation sim;
+        TV_CHECK(sim.SpawnAndBuild(At(0.0f, 80.0f)) != nullptr);
+        TV_CHECK(world.GetLoadedAssetCount() > 1);
+        sim.factory.Dispose();
+    }
+
+    // Only the resident core dictionary is left
+    TV_CHECK_EQ(world.GetLoadedAssetCount(), 1);
+    TV_CHECK_EQ(world.GetEffectCount(), 0);
+    TV_CHECK_EQ(world.GetBlipCount(), 0);
+}
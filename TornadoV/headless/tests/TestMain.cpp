@@ -0,0 +1,38 @@
+#include "Check.h"
+#include <cstring>
+
+namespace tvtest {
+
+static int g_failures = 0;
+
+std::vector<TestCase>& Registry() {
+    static std::vector<TestCase> registry;
+    return registry;
+}
+
+void Fail(const char* file, int line, const std::string& message) {
+    std::printf("  %s:%d: %s\n", file, line, message.c_str());
+    g_failures++;
+}
+
+} // namespace tvtest
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : "";
+
+    int ran = 0;
+    int failedCases = 0;
+    for (const tvtest::TestCase& test : tvtest::Registry()) {
+        if (std::strncmp(test.name, filter, std::strlen(filter)) != 0) continue;
+
+        int before = tvtest::g_failures;
+        test.run();
+        bool passed = tvtest::g_failures == before;
+        std::printf("[%s] %s\n", passed ? "PASS" : "FAIL", test.name);
+        if (!passed) failedCases++;
+        ran++;
+    }
+
+    std::printf("%d cases, %d failed\n", ran, failedCases);
+    return (ran == 0 || failedCases > 0) ? 1 : 0;
+}
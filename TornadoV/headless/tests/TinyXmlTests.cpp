@@ -0,0 +1,186 @@
+#include "Check.h"
+#include "tinyxml2/tinyxml2.h"
+#include <cstring>
+#include <string>
+
+using namespace tinyxml2;
+
+namespace {
+
+XMLError ParseText(XMLDocument& doc, const std::string& xml) {
+    return doc.Parse(xml.data(), xml.size());
+}
+
+const char* MENU =
+    "\xEF\xBB\xBF<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<!-- TornadoV menu -->\n"
+    "<MenuConfig>\n"
+    "    <Frame>\n"
+    "        <TitleBox r=\"184\" g='162' b = \"57\" a=\"255\" />\n"
+    "        <!-- selection -->\n"
+    "        <SelectionBar r=\"255\" g=\"255\" b=\"255\" a=\"255\"/>\n"
+    "    </Frame>\n"
+    "    <Layout>\n"
+    "        <X value=\"0.15\" />\n"
+    "        <Y value=\"0.10\" />\n"
+    "    </Layout>\n"
+    "    <Title>  Tornado &amp; Co  </Title>\n"
+    "</MenuConfig>\n";
+
+} // namespace
+
+TV_TEST(TinyXml_ParsesNesting) {
+    XMLDocument doc;
+    TV_CHECK_EQ((int)ParseText(doc, MENU), (int)XML_SUCCESS);
+    TV_CHECK(!doc.Error());
+
+    XMLElement* root = doc.RootElement();
+    TV_CHECK(root != nullptr);
+    TV_CHECK_EQ(std::string(root->Name()), std::string("MenuConfig"));
+
+    XMLElement* frame = root->FirstChildElement("Frame");
+    TV_CHECK(frame != nullptr);
+    TV_CHECK(frame->Parent() == root);
+    TV_CHECK_EQ(std::string(frame->FirstChildElement()->Name()), std::string("TitleBox"));
+
+    // Element lookups step over comments
+    XMLElement* title = frame->FirstChildElement("TitleBox");
+    XMLElement* bar = title->NextSiblingElement();
+    TV_CHECK(bar != nullptr);
+    TV_CHECK_EQ(std::string(bar->Name()), std::string("SelectionBar"));
+    TV_CHECK(bar->NextSiblingElement() == nullptr);
+    TV_CHECK(title->NextSibling()->IsComment());
+
+    XMLElement* y = root->FirstChildElement("Layout")->FirstChildElement("Y");
+    TV_CHECK_EQ(std::string(y->Attribute("value")), std::string("0.10"));
+    TV_CHECK(root->FirstChildElement("Missing") == nullptr);
+    TV_CHECK(y->FirstChildElement() == nullptr);
+}
+
+TV_TEST(TinyXml_Attributes) {
+    XMLDocument doc;
+    ParseText(doc, MENU);
+    XMLElement* title = doc.RootElement()->FirstChildElement("Frame")->FirstChildElement("TitleBox");
+
+    // Double, single and spaced quoting
+    TV_CHECK_EQ(title->AttributeCount(), 4);
+    TV_CHECK_EQ(std::string(title->Attribute("r")), std::string("184"));
+    TV_CHECK_EQ(std::string(title->Attribute("g")), std::string("162"));
+    TV_CHECK_EQ(std::string(title->Attribute("b")), std::string("57"));
+    TV_CHECK(title->Attribute("x") == nullptr);
+
+    // Shorter values rewrite in place, longer ones move to the arena
+    title->SetAttribute("r", 9);
+    title->SetAttribute("g", "1620000");
+    title->SetAttribute("new", "yes");
+    TV_CHECK_EQ(std::string(title->Attribute("r")), std::string("9"));
+    TV_CHECK_EQ(std::string(title->Attribute("g")), std::string("1620000"));
+    TV_CHECK_EQ(std::string(title->Attribute("new")), std::string("yes"));
+    TV_CHECK_EQ(title->AttributeCount(), 5);
+}
+
+TV_TEST(TinyXml_SetEmptyAttributes) {
+    XMLDocument doc;
+    ParseText(doc, "<a x=\"\" y=\"abc\"/>");
+    XMLElement* root = doc.RootElement();
+
+    // New attributes have no storage to rewrite, even when the value is empty
+    root->SetAttribute("fresh", "");
+    TV_CHECK_EQ(std::string(root->Attribute("fresh")), std::string(""));
+    root->SetAttribute("fresh", "grown");
+    TV_CHECK_EQ(std::string(root->Attribute("fresh")), std::string("grown"));
+
+    root->SetAttribute("x", "");
+    root->SetAttribute("y", "");
+    TV_CHECK_EQ(std::string(root->Attribute("x")), std::string(""));
+    TV_CHECK_EQ(std::string(root->Attribute("y")), std::string(""));
+    root->SetAttribute("y", "ab");
+    TV_CHECK_EQ(std::string(root->Attribute("y")), std::string("ab"));
+
+    XMLDocument reparsed;
+    TV_CHECK_EQ((int)ParseText(reparsed, doc.ToString()), (int)XML_SUCCESS);
+    XMLElement* copy = reparsed.RootElement();
+    TV_CHECK_EQ(copy->AttributeCount(), 3);
+    TV_CHECK_EQ(std::string(copy->Attribute("x")), std::string(""));
+    TV_CHECK_EQ(std::string(copy->Attribute("y")), std::string("ab"));
+    TV_CHECK_EQ(std::string(copy->Attribute("fresh")), std::string("grown"));
+}
+
+TV_TEST(TinyXml_DecodesEntities) {
+    XMLDocument doc;
+    TV_CHECK_EQ((int)ParseText(doc, "<a v=\"&lt;&gt;&amp;&quot;&apos;\" n=\"&#65;&#x42;&#x263A;\" u=\"a&b &bogus; c\">x &lt; y</a>"), (int)XML_SUCCESS);
+
+    XMLElement* a = doc.RootElement();
+    TV_CHECK_EQ(std::string(a->Attribute("v")), std::string("<>&\"'"));
+    TV_CHECK_EQ(std::string(a->Attribute("n")), std::string("AB\xE2\x98\xBA"));
+    TV_CHECK_EQ(std::string(a->Attribute("u")), std::string("a&b &bogus; c"));
+    TV_CHECK_EQ(std::string(a->GetText()), std::string("x < y"));
+
+    // Text is trimmed; CDATA is taken as-is
+    XMLDocument menu;
+    ParseText(menu, MENU);
+    TV_CHECK_EQ(std::string(menu.RootElement()->FirstChildElement("Title")->GetText()), std::string("Tornado & Co"));
+    ParseText(doc, "<a><![CDATA[<raw> &amp;]]></a>");
+    TV_CHECK_EQ(std::string(doc.RootElement()->GetText()), std::string("<raw> &amp;"));
+    ParseText(doc, "<a>   </a >");
+    TV_CHECK(doc.RootElement()->GetText() == nullptr);
+}
+
+TV_TEST(TinyXml_KeepsComments) {
+    XMLDocument doc;
+    ParseText(doc, MENU);
+    std::string text = doc.ToString();
+    TV_CHECK(text.find("<!-- TornadoV menu -->") != std::string::npos);
+    TV_CHECK(text.find("<!-- selection -->") != std::string::npos);
+
+    XMLElement* comment = doc.RootElement()->FirstChildElement("Frame")->FirstChild()->NextSibling();
+    TV_CHECK(comment->IsComment());
+    TV_CHECK_EQ(std::string(comment->Value()), std::string(" selection "));
+}
+
+TV_TEST(TinyXml_RoundTrip) {
+    XMLDocument doc;
+    ParseText(doc, MENU);
+    doc.RootElement()->FirstChildElement("Layout")->FirstChildElement("X")->SetAttribute("value", "a\"<b>&");
+    doc.RootElement()->InsertNewChild("General")->InsertNewChild("IntStep")->SetAttribute("value", 5);
+    std::string first = doc.ToString();
+
+    XMLDocument reparsed;
+    TV_CHECK_EQ((int)ParseText(reparsed, first), (int)XML_SUCCESS);
+    TV_CHECK_EQ(reparsed.ToString(), first);
+
+    XMLElement* root = reparsed.RootElement();
+    TV_CHECK_EQ(std::string(root->FirstChildElement("Layout")->FirstChildElement("X")->Attribute("value")), std::string("a\"<b>&"));
+    TV_CHECK_EQ(std::string(root->FirstChildElement("General")->FirstChildElement("IntStep")->Attribute("value")), std::string("5"));
+    TV_CHECK_EQ(std::string(root->FirstChildElement("Title")->GetText()), std::string("Tornado & Co"));
+}
+
+TV_TEST(TinyXml_RejectsMalformed) {
+    const char* bad[] = {
+        "",
+        "no markup",
+        "<a><!-- open",
+        "<a b></a>",
+        "<a b=c></a>",
+        "<a b=\"c></a>",
+        "<a/ >",
+        "</a>",
+        "<>",
+        "<a>",
+        "<a><b></b>",
+        "<a><b></a>",
+        "<a></b>",
+    };
+    for (const char* xml : bad) {
+        XMLDocument doc;
+        if (ParseText(doc, xml) == XML_SUCCESS) {
+            tvtest::Fail(__FILE__, __LINE__, std::string("parsed: ") + xml);
+        }
+        TV_CHECK(doc.Error());
+    }
+
+    XMLDocument doc;
+    TV_CHECK_EQ((int)doc.LoadFile("/nonexistent/menu_config.xml"), (int)XML_ERROR_FILE_NOT_FOUND);
+    TV_CHECK(doc.RootElement() == nullptr);
+    TV_CHECK_EQ(doc.ToString(), std::string(""));
+}
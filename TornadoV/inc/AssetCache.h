@@ -0,0 +1,61 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include "types.h"
+
+enum class AssetKind {
+    Ptfx,
+    Model
+};
+
+enum class AssetState {
+    Loading,
+    Loaded,
+    TimedOut // Still polled, but waiters stop holding on it
+};
+
+// Reference-counted streaming requests shared by every vortex.
+// Each asset is requested once when its first reference is taken, polled once
+// per frame from Update() and released when the last reference goes away.
+// Lookups only read cached state, so callers never issue streaming natives.
+class AssetCache {
+public:
+    typedef unsigned long long Key;
+
+    static AssetCache& Get();
+
+    // Same hash the game uses for GET_HASH_KEY, computed without a native call
+    static Hash HashName(const std::string& name);
+
+    Key Acquire(AssetKind kind, const std::string& name);
+    void Release(Key key);
+
+    bool IsLoaded(Key key) const;
+    bool IsLoaded(AssetKind kind, const std::string& name) const { return IsLoaded(MakeKey(kind, HashName(name))); }
+    // Loaded or given up on; either way waiters can continue
+    bool IsSettled(Key key) const;
+
+    void Update();
+
+private:
+    AssetCache() = default;
+
+    struct Entry {
+        AssetKind kind;
+        Hash hash;
+        std::string name;
+        int refCount;
+        int pendingFrames;
+        AssetState state;
+    };
+
+    static Key MakeKey(AssetKind kind, Hash hash) { return ((Key)kind << 32) | hash; }
+    static bool IsResident(const Entry& entry);
+    static void Request(const Entry& entry);
+    static bool QueryLoaded(const Entry& entry);
+
+    static const int TIMEOUT_FRAMES = 300;
+    static const int REREQUEST_INTERVAL = 30;
+
+    std::unordered_map<Key, Entry> m_entries;
+};
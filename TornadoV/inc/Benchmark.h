@@ -0,0 +1,20 @@
+#pragma once
+#include <string>
+#include <vector>
+
+struct BenchmarkResult {
+    std::string name;
+    long long iterations; // Operations timed per sample
+    double nsPerOp;       // Median over the samples
+    double nsPerOpMin;
+};
+
+// Self-contained micro-benchmarks for MathEx, the vortex kernels, multi-vortex ticks and the config store.
+// Nothing here calls the game, so it can run from the menu or any host.
+// Results are written in Google Benchmark's JSON layout so runs from
+// different commits can be diffed with its compare tooling.
+class Benchmark {
+public:
+    static std::vector<BenchmarkResult> RunAll();
+    static bool WriteJson(const std::vector<BenchmarkResult>& results, const std::string& path, const std::string& executable = "TornadoV.asi");
+};
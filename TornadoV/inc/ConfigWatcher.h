@@ -0,0 +1,36 @@
+#pragma once
+#include <memory>
+#include <string>
+
+class IniStore;
+namespace tinyxml2 { class XMLDocument; }
+
+enum class ConfigFile {
+    Ini,
+    Xml
+};
+
+// Hot reload for TornadoV.ini and menu_config.xml.
+// A background thread waits on directory change notifications
+// (ReadDirectoryChangesW on Windows, inotify elsewhere), re-reads a changed
+// file and parses it off the game thread. The parsed copy is published through
+// an atomic shared_ptr swap, and Apply() adopts it on the script thread once
+// per frame. Files whose content matches what we last loaded or wrote are
+// ignored, so the mod's own saves never come back as reloads.
+class ConfigWatcher {
+public:
+    static void Start(const std::string& iniPath, const std::string& xmlPath);
+    // Signals the thread to exit; never joins, so it is safe from DllMain
+    static void Stop();
+
+    // Script thread, once per frame
+    static void Apply();
+
+    // Writers call this with the exact text they are about to save
+    static void NoteContent(ConfigFile file, const std::string& text);
+    static unsigned long long HashContent(const std::string& text);
+
+    // Latest parsed snapshots, or null; each is handed out once
+    static std::shared_ptr<const IniStore> TakeIni();
+    static std::shared_ptr<tinyxml2::XMLDocument> TakeXml();
+};
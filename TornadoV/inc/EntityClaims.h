@@ -0,0 +1,22 @@
+#pragma once
+#include <unordered_map>
+#include "types.h"
+
+// Which vortex is pulling each entity, shared by every vortex of the factory.
+// A vortex only adds entities the grid made it dominant for and lets go of any
+// another vortex has claimed since, so an entity is never pulled twice.
+// Owners are TornadoVortex ids.
+class EntityClaims {
+public:
+    static const int NoOwner = -1;
+
+    int OwnerOf(Entity handle) const;
+    void Claim(Entity handle, int owner);
+    // Only drops the claim while owner still holds it
+    void Release(Entity handle, int owner);
+    void Clear() { m_owners.clear(); }
+    int Size() const { return (int)m_owners.size(); }
+
+private:
+    std::unordered_map<Entity, int> m_owners;
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include "types.h"
+#include "EntityGrid.h"
+
+enum class MassClass : unsigned char {
+    Light,  // Peds, bikes, loose props
+    Medium,
+    Heavy   // Trucks, industrial, military
+};
+
+// What a pulled entity is, packed into one byte when a vortex captures it.
+// None of it can change while the entity is held, so the per-frame force
+// pass reads these bits instead of asking the game again.
+// Bits 0-1: EntityKind, 2: plane, 3: helicopter, 4: boat, 5-6: MassClass.
+class EntityClassifier {
+public:
+    // The model is only consulted for vehicles; vehicle models are classified
+    // once and remembered for the rest of the session
+    static unsigned char Classify(EntityKind kind, Hash model);
+
+    static EntityKind Kind(unsigned char packed) { return (EntityKind)(packed & KIND_MASK); }
+    static bool IsPed(unsigned char packed) { return Kind(packed) == EntityKind::Ped; }
+    static bool IsPlane(unsigned char packed) { return (packed & PLANE) != 0; }
+    static bool IsHeli(unsigned char packed) { return (packed & HELI) != 0; }
+    static bool IsBoat(unsigned char packed) { return (packed & BOAT) != 0; }
+    static MassClass Mass(unsigned char packed) { return (MassClass)((packed >> MASS_SHIFT) & 0x03); }
+
+    static int GetKnownModelCount();
+
+private:
+    static const unsigned char KIND_MASK = 0x03;
+    static const unsigned char PLANE = 1 << 2;
+    static const unsigned char HELI = 1 << 3;
+    static const unsigned char BOAT = 1 << 4;
+    static const int MASS_SHIFT = 5;
+
+    static unsigned char ClassifyVehicleModel(Hash model);
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include <vector>
+#include "types.h"
+
+// Per-frame memo of the entity properties the vortices keep asking the game for.
+// Each property is fetched lazily, at most once per entity per frame, and the
+// answer is shared by the grid rebuild, every vortex's collection and force
+// passes and the release checks. Entries are stamped with the frame they were
+// filled in, so BeginFrame() invalidates everything without touching the table.
+// Only read-only queries live here; anything our own calls change during the
+// frame (ragdoll state, velocity) is still asked for directly.
+class EntityFrameCache {
+public:
+    EntityFrameCache();
+
+    // Once per frame, before the first lookup
+    void BeginFrame();
+
+    bool Exists(Entity entity);
+    Vector3 Coords(Entity entity);
+    float HeightAboveGround(Entity entity);
+    Hash Model(Entity entity);
+
+    int Size() const { return m_live; }
+
+private:
+    enum Field : unsigned char {
+        HasExists = 1 << 0,
+        HasCoords = 1 << 1,
+        HasHeight = 1 << 2,
+        HasModel = 1 << 3
+    };
+
+    struct Entry {
+        Entity handle = 0;
+        unsigned int frame = 0; // Entry is empty unless this equals m_frame
+        unsigned char known = 0;
+        bool exists = false;
+        Hash model = 0;
+        float height = 0.0f;
+        Vector3 coords = { 0.0f, 0, 0.0f, 0, 0.0f, 0 };
+    };
+
+    int HomeSlot(Entity entity) const;
+    Entry& Lookup(Entity entity);
+    void Grow();
+
+    std::vector<Entry> m_table;
+    int m_mask;
+    int m_live; // Entries stamped with the current frame
+    unsigned int m_frame;
+};
@@ -0,0 +1,58 @@
+#pragma once
+#include <vector>
+#include "types.h"
+
+enum class EntityKind : unsigned char {
+    Ped,
+    Vehicle,
+    Object
+};
+
+struct GridEntity {
+    Entity handle;
+    Vector3 position;
+    EntityKind kind;
+};
+
+// Frame-scoped uniform 2D cell hash over the world entity pools.
+// TornadoFactory fills it once per scan tick, every vortex then only visits the
+// cells overlapping its pull disc instead of walking all peds/vehicles/objects.
+class EntityGrid {
+public:
+    EntityGrid();
+
+    void Clear();
+    void Insert(Entity handle, const Vector3& position, EntityKind kind);
+    void Build();
+
+    // Appends indices of every entity within radius (2D) of center.
+    // Indices come back in insertion order so pool priority (peds first) is kept.
+    void Query(const Vector3& center, float radius, std::vector<int>& outIndices) const;
+
+    // Dominant vortex per entity, for several vortices sharing one grid. Call once
+    // per vortex after Build(); each entity in the disc goes to whichever caller's
+    // center is closest in 2D. Owner() is -1 for entities no disc reached.
+    void ClaimOwners(int owner, const Vector3& center, float radius);
+    int Owner(int index) const { return m_owner[index]; }
+
+    const GridEntity& Get(int index) const { return m_entities[index]; }
+    int GetCount() const { return (int)m_entities.size(); }
+
+private:
+    static constexpr float CellSize = 32.0f;
+    static const int BucketCount = 4096; // Must stay a power of two
+
+    static int CellCoord(float value);
+    static int BucketOf(int cellX, int cellY);
+
+    std::vector<GridEntity> m_entities;
+    std::vector<int> m_bucketOf;
+    std::vector<int> m_bucketStart;
+    std::vector<int> m_sorted;
+    std::vector<int> m_owner;
+    std::vector<float> m_ownerDist;
+    std::vector<int> m_claimCandidates;
+    // Query() marks a bucket visited by stamping it with the query's generation
+    mutable std::vector<unsigned int> m_bucketStamp;
+    mutable unsigned int m_queryStamp;
+};
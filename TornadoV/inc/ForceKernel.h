@@ -0,0 +1,37 @@
+#pragma once
+#include <vector>
+#include "types.h"
+
+// Per-frame batch of pulled entities waiting for forces.
+// Inputs are gathered while validating entities, outputs are filled by ForceKernel.
+struct ForceBatch {
+    // Inputs
+    std::vector<Entity> handles;
+    std::vector<unsigned char> isPlayer;
+    std::vector<float> posX, posY, posZ;
+    std::vector<float> xBias, yBias;
+    std::vector<float> dist; // 2D distance to the vortex core
+    std::vector<unsigned char> classification; // Passed through for the game-call pass
+
+    // Outputs
+    std::vector<unsigned char> valid; // 0 when the pull direction is degenerate
+    std::vector<float> dirX, dirY, dirZ; // Normalized pull toward the biased core
+    std::vector<float> upX, upY, upZ; // Normalized lift toward the core + 1000 up
+    std::vector<float> tanX, tanY, tanZ; // Normalized cross(dir, worldUp)
+
+    int Size() const { return (int)handles.size(); }
+    void Clear();
+    void Push(Entity handle, const Vector3& position, float biasX, float biasY, bool player, float distance, unsigned char cls = 0);
+};
+
+// Pure maths stage of UpdatePulledEntities, no game calls.
+// Compute uses SSE when the target has it and falls back to ComputeScalar,
+// which is the original per-entity MathEx path. Both produce identical bits.
+class ForceKernel {
+public:
+    static void Compute(ForceBatch& batch, const Vector3& core);
+    static void ComputeScalar(ForceBatch& batch, const Vector3& core, int begin = 0);
+
+private:
+    static void ResizeOutputs(ForceBatch& batch);
+};
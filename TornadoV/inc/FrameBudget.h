@@ -0,0 +1,31 @@
+#pragma once
+#include <chrono>
+
+// Wall-clock slice of the current script frame.
+// update() creates one for the whole frame, TornadoFactory splits it between vortices.
+class FrameBudget {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit FrameBudget(float microseconds)
+        : m_start(Clock::now()), m_deadline(m_start + ToDuration(microseconds)) {}
+
+    bool Expired() const { return Clock::now() >= m_deadline; }
+
+    float ElapsedMicroseconds() const {
+        return std::chrono::duration<float, std::micro>(Clock::now() - m_start).count();
+    }
+
+    float RemainingMicroseconds() const {
+        float remaining = std::chrono::duration<float, std::micro>(m_deadline - Clock::now()).count();
+        return remaining > 0.0f ? remaining : 0.0f;
+    }
+
+private:
+    static Clock::duration ToDuration(float microseconds) {
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float, std::micro>(microseconds));
+    }
+
+    Clock::time_point m_start;
+    Clock::time_point m_deadline;
+};
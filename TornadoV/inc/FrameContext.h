@@ -0,0 +1,20 @@
+#pragma once
+#include "types.h"
+
+// Game state every system reads each frame, captured once at the top of
+// update() in script.cpp and passed down by const reference. Nothing below
+// update() asks the game for the timer, frame time, player or camera itself.
+struct FrameContext {
+    int gameTime = 0;
+    float frameTime = 0.0f;
+
+    Ped playerPed = 0;
+    Vehicle playerVehicle = 0; // 0 when on foot
+    Vector3 playerPos = { 0.0f, 0, 0.0f, 0, 0.0f, 0 };
+
+    Vector3 camPos = { 0.0f, 0, 0.0f, 0, 0.0f, 0 };
+    Vector3 camRot = { 0.0f, 0, 0.0f, 0, 0.0f, 0 };
+    Vector3 camForward = { 0.0f, 0, 1.0f, 0, 0.0f, 0 };
+
+    float rainLevel = 0.0f;
+};
@@ -2,51 +2,65 @@
 #include <string>
 #include <vector>
 #include <Windows.h>
+#include "IniStore.h"
 
 class IniHelper {
 public:
+    struct IniSetting {
+        std::string section;
+        std::string key;
+        std::string defaultValue;
+    };
+
     static void Initialize(HMODULE hModule = NULL);
     static void DeployDefaultConfig(HMODULE hModule);
     static void ValidateAndRepairConfig();
+
+    // Every setting the mod reads, with the value a fresh install gets
+    static const std::vector<IniSetting>& RequiredSettings();
+    // "[Section] Key" of the first required setting the store lacks, or empty
+    static std::string FindMissingSetting(const IniStore& store);
     
+    // Edits the resident store; Update() saves once writes have been quiet for a moment
     static void WriteValue(const std::string& section, const std::string& key, const std::string& value);
+    // Once per frame: writes pending edits when they're due
+    static void Update();
+    // Writes any unsaved changes synchronously
+    static void Shutdown();
+    // Replaces the resident store with one parsed from an edited file
+    static void Adopt(const IniStore& store);
     
+    // Reads come from the resident IniStore; the file is only parsed in Initialize
     template<typename T>
     static T GetValue(const std::string& section, const std::string& key, T defaultValue);
+    static std::string GetValue(const std::string& section, const std::string& key, const char* defaultValue) {
+        return Store.GetString(section, key, defaultValue);
+    }
 
     static void ShowNotification(const std::string& message);
     static std::string GetIniPath() { return IniPath; }
 
 private:
+    static bool Save();
+
     static std::string IniPath;
+    static IniStore Store;
 };
 
 // Template implementations
 template<typename T>
 inline T IniHelper::GetValue(const std::string& section, const std::string& key, T defaultValue) {
-    char buffer[255];
-    GetPrivateProfileStringA(section.c_str(), key.c_str(), "", buffer, 255, IniPath.c_str());
-    
-    std::string val(buffer);
-    if (val.empty()) {
-        return defaultValue;
-    }
-
-    try {
-        if constexpr (std::is_same_v<T, std::string>) {
-            return val;
-        } else if constexpr (std::is_same_v<T, bool>) {
-            return (val == "true" || val == "1" || val == "yes");
-        } else if constexpr (std::is_same_v<T, int>) {
-            return std::stoi(val);
-        } else if constexpr (std::is_same_v<T, float>) {
-            return std::stof(val);
-        } else if constexpr (std::is_same_v<T, double>) {
-            return std::stod(val);
-        } else {
-            return defaultValue;
-        }
-    } catch (...) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return Store.GetString(section, key, defaultValue);
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return Store.GetBool(section, key, defaultValue);
+    } else if constexpr (std::is_same_v<T, int>) {
+        return Store.GetInt(section, key, defaultValue);
+    } else if constexpr (std::is_same_v<T, float>) {
+        return Store.GetFloat(section, key, defaultValue);
+    } else if constexpr (std::is_same_v<T, double>) {
+        return Store.GetDouble(section, key, defaultValue);
+    } else {
         return defaultValue;
     }
 }
@@ -0,0 +1,83 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+// In-memory copy of an INI file, parsed once and kept resident.
+// Lookups hash the section/key pair (case-insensitive, like the profile API)
+// and return values already converted to their numeric form, so reading a
+// setting never touches the disk. Comments, blank lines and key spacing are
+// kept verbatim, and edits only mark the store dirty until Flush() writes the
+// whole file once through a temp file and a rename.
+// Uses only the standard library so it builds on any host.
+class IniStore {
+public:
+    bool Load(const std::string& path);
+    void Parse(const std::string& text);
+    std::string Serialize() const;
+
+    // Writes the file if anything changed since the last Load/Flush
+    bool Flush(const std::string& path);
+    // Same, but writes text the caller already got from Serialize()
+    bool Flush(const std::string& path, const std::string& text);
+
+    bool Has(const std::string& section, const std::string& key) const { return Find(section, key) != nullptr; }
+    std::string GetString(const std::string& section, const std::string& key, const std::string& defaultValue) const;
+    bool GetBool(const std::string& section, const std::string& key, bool defaultValue) const;
+    int GetInt(const std::string& section, const std::string& key, int defaultValue) const;
+    float GetFloat(const std::string& section, const std::string& key, float defaultValue) const;
+    double GetDouble(const std::string& section, const std::string& key, double defaultValue) const;
+
+    // Returns true if the stored value changed
+    bool Set(const std::string& section, const std::string& key, const std::string& value);
+
+    bool IsDirty() const { return m_dirty; }
+    size_t Size() const { return m_entries.size(); }
+    void Clear();
+
+private:
+    enum class LineKind {
+        Text,    // Comment, blank or anything unparsed; written back as-is
+        Section,
+        Key
+    };
+
+    struct Line {
+        LineKind kind;
+        std::string text;  // Raw line as read
+        size_t valueStart; // Key lines: where the value begins in text
+        int entry;
+        bool edited;       // Key lines: rebuilt from text prefix + value when written
+    };
+
+    struct Entry {
+        std::string section; // Lower-cased
+        std::string key;     // Lower-cased
+        std::string value;
+        double number;
+        bool isNumber;
+        bool flag;
+        size_t line;
+    };
+
+    struct SectionInfo {
+        std::string name; // Lower-cased
+        size_t lastLine;  // New keys are inserted after this line
+    };
+
+    static unsigned long long HashKey(const std::string& section, const std::string& key);
+    static std::string Lower(const std::string& text);
+    static void SetEntryValue(Entry& entry, const std::string& value);
+
+    const Entry* Find(const std::string& section, const std::string& key) const;
+    void AddLine(const std::string& raw, int& currentSection);
+    void InsertLine(size_t at, const Line& line);
+
+    std::vector<Line> m_lines;
+    std::vector<Entry> m_entries;
+    std::vector<SectionInfo> m_sections;
+    std::unordered_multimap<unsigned long long, int> m_index;
+    bool m_crlf = true;
+    bool m_bom = false;
+    bool m_dirty = false;
+};
@@ -1,15 +1,49 @@
 #pragma once
+#include <cstdint>
 #include <string>
-#include <fstream>
-#include <mutex>
 
+enum class LogLevel {
+    Debug = 0,
+    Info = 1,
+    Warn = 2,
+    Error = 3
+};
+
+// Records below this level are compiled out. Debug builds keep everything.
+#ifndef TORNADOV_LOG_MIN_LEVEL
+#ifdef _DEBUG
+#define TORNADOV_LOG_MIN_LEVEL 0
+#else
+#define TORNADOV_LOG_MIN_LEVEL 1
+#endif
+#endif
+
+// Asynchronous logger. Callers copy the message into a lock-free bounded ring
+// and return; a background thread formats timestamps and writes batches to a
+// file it keeps open. When the ring is full the record is dropped and counted.
 class Logger {
 public:
+    static constexpr LogLevel MinLevel = (LogLevel)TORNADOV_LOG_MIN_LEVEL;
+    static constexpr bool IsEnabled(LogLevel level) { return level >= MinLevel; }
+
     static void Initialize(const std::string& filePath);
-    static void Log(const std::string& message);
-    static void Error(const std::string& message);
+    // Drains the ring on the calling thread and closes the file. Never joins,
+    // so it is safe from DllMain.
+    static void Shutdown();
+
+    static void Write(LogLevel level, const std::string& message);
+
+    static void Debug(const std::string& message) { if constexpr (IsEnabled(LogLevel::Debug)) Write(LogLevel::Debug, message); }
+    static void Log(const std::string& message) { if constexpr (IsEnabled(LogLevel::Info)) Write(LogLevel::Info, message); }
+    static void Warn(const std::string& message) { if constexpr (IsEnabled(LogLevel::Warn)) Write(LogLevel::Warn, message); }
+    static void Error(const std::string& message) { if constexpr (IsEnabled(LogLevel::Error)) Write(LogLevel::Error, message); }
+
+    static uint64_t GetDroppedCount();
 
 private:
-    static std::string m_filePath;
-    static std::mutex m_mutex;
+    static void WriterLoop();
+    static void DrainLocked();
 };
+
+// Skips building the message at all when the level is compiled out
+#define TV_LOG_DEBUG(message) do { if constexpr (Logger::IsEnabled(LogLevel::Debug)) Logger::Debug(message); } while (0)
@@ -0,0 +1,92 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "Profiler.h"
+
+// Opt-in native call accounting. Define TORNADOV_NATIVE_STATS to enable it;
+// otherwise TV_NATIVE(call) is just (call) and TV_NATIVE_SCOPE does nothing.
+//
+//     TV_NATIVE_SCOPE("Vortex::UpdatePulledEntities", _id);
+//     Vector3 pos = TV_NATIVE(ENTITY::GET_ENTITY_COORDS(ent, true));
+//
+// Every wrapped call is counted by call site and attributed to the innermost
+// scope (subsystem plus owner, e.g. a vortex id). One call in SampleRate per
+// site is timed, and WriteReport ranks sites by estimated time per frame.
+class NativeStats {
+public:
+    static const int MaxSites = 192;
+    static const int MaxScopes = 48;
+    static const int SampleRate = 16;
+
+    static int RegisterSite(const char* callText, const char* file, int line);
+    static int EnterScope(const char* subsystem, int owner); // Returns the previous scope
+    static void LeaveScope(int previous) { m_currentScope = previous; }
+
+    // Counts a call; true when this one should be timed
+    static bool Count(int site);
+    static void AddSample(int site, uint64_t ticks);
+
+    static void EndFrame() { m_frames++; }
+    static void Reset();
+    static bool WriteReport(const std::string& path);
+
+private:
+    struct Site {
+        std::string native; // "ENTITY::GET_ENTITY_COORDS"
+        const char* file;
+        int line;
+        uint64_t calls;
+        uint64_t sampledTicks;
+        uint64_t samples;
+    };
+
+    struct Scope {
+        const char* subsystem;
+        int owner;
+    };
+
+    static Site m_sites[MaxSites];
+    static Scope m_scopes[MaxScopes];
+    static uint64_t m_scopeCalls[MaxScopes][MaxSites];
+    static int m_siteCount;
+    static int m_scopeCount;
+    static int m_currentScope;
+    static uint64_t m_frames;
+};
+
+class NativeSampleTimer {
+public:
+    explicit NativeSampleTimer(int site)
+        : m_site(site), m_start(NativeStats::Count(site) ? Profiler::Now() : 0) {}
+    ~NativeSampleTimer() {
+        if (m_start != 0) NativeStats::AddSample(m_site, Profiler::Now() - m_start);
+    }
+
+private:
+    int m_site;
+    uint64_t m_start;
+};
+
+class NativeScope {
+public:
+    NativeScope(const char* subsystem, int owner) : m_previous(NativeStats::EnterScope(subsystem, owner)) {}
+    ~NativeScope() { NativeStats::LeaveScope(m_previous); }
+
+private:
+    int m_previous;
+};
+
+#ifdef TORNADOV_NATIVE_STATS
+#define TV_NATIVE(call) \
+    ([&]() { \
+        static const int _tvSite = NativeStats::RegisterSite(#call, __FILE__, __LINE__); \
+        NativeSampleTimer _tvTimer(_tvSite); \
+        return call; \
+    }())
+#define TV_NATIVE_SCOPE(subsystem, owner) NativeScope TV_PROFILE_CONCAT(_tvNativeScope, __LINE__)(subsystem, owner)
+#define TV_NATIVE_END_FRAME() NativeStats::EndFrame()
+#else
+#define TV_NATIVE(call) (call)
+#define TV_NATIVE_SCOPE(subsystem, owner) ((void)0)
+#define TV_NATIVE_END_FRAME() ((void)0)
+#endif
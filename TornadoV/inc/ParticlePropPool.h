@@ -0,0 +1,35 @@
+#pragma once
+#include <vector>
+#include "types.h"
+
+// Recycles the invisible props TornadoParticle attaches its effects to.
+// Released props are parked hidden, frozen and collision-less below the map
+// instead of being deleted, and handed out again on the next Build.
+// At most HighWaterMark props stay parked, the rest are deleted.
+class ParticlePropPool {
+public:
+    static constexpr const char* PROP_MODEL = "prop_beach_volball02";
+
+    ParticlePropPool();
+    ~ParticlePropPool();
+
+    // Returns a prop moved to position, 0 if none could be created
+    Entity Acquire(const Vector3& position);
+    void Release(Entity prop);
+
+    void SetHighWaterMark(int maxParked);
+    int GetHighWaterMark() const { return m_highWaterMark; }
+    int GetParkedCount() const { return (int)m_parked.size(); }
+
+    // Deletes every parked prop
+    void Clear();
+
+private:
+    static Entity CreateProp(const Vector3& position);
+    void Trim();
+
+    static constexpr float PARK_DEPTH = -150.0f;
+
+    std::vector<Entity> m_parked;
+    int m_highWaterMark;
+};
@@ -0,0 +1,77 @@
+#pragma once
+#include <vector>
+#include "types.h"
+#include "MathEx.h"
+
+// Structure-of-arrays orbit state for every particle prop of one vortex.
+// Advance() moves all angles and computes all world positions in one pass
+// (SSE where available), Apply() then hands them to the caller's game calls.
+// Indices match the order particles were added in. Nothing here includes
+// natives.h, so the orbit maths builds and runs outside the game.
+class ParticleSystem {
+public:
+    int Size() const { return (int)m_props.size(); }
+
+    // angularRate scales the vortex rotation speed for this particle
+    int Add(Entity prop, int layer, const Quaternion& rotation, float radius, float offsetZ, float angularRate);
+    void Clear();
+
+    // Computes positions around center at the current angles, then steps the
+    // angles by angleStep * angularRate, matching the old per-particle order
+    void Advance(const Vector3& center, float angleStep);
+
+    // Moves live props to their computed positions. With an interval above 1
+    // only layers whose phase matches frame are moved, so the layers take turns.
+    // A slice of at most existenceChecks props is checked for existence this
+    // frame; props found missing are reported through deadOut and never touched again.
+    // exists(Entity) -> bool and move(Entity, x, y, z) are the game calls.
+    template<class ExistsFn, class MoveFn>
+    void Apply(int existenceChecks, int interval, int frame, std::vector<int>& deadOut, ExistsFn&& exists, MoveFn&& move);
+
+    Vector3 GetPosition(int index) const;
+    bool IsAlive(int index) const { return m_alive[index] != 0; }
+
+private:
+    static void AdvanceScalar(ParticleSystem& system, const Vector3& center, float angleStep, int begin);
+
+    std::vector<Entity> m_props;
+    std::vector<unsigned char> m_alive;
+    std::vector<int> m_layer;
+    std::vector<float> m_angle;
+    std::vector<float> m_radius;
+    std::vector<float> m_rate;
+    std::vector<float> m_offsetZ;
+
+    // First two columns of the particle's rotation matrix; the orbit vector has no z
+    std::vector<float> m_r00, m_r10, m_r20;
+    std::vector<float> m_r01, m_r11, m_r21;
+
+    std::vector<float> m_outX, m_outY, m_outZ;
+
+    int m_checkCursor = 0;
+};
+
+template<class ExistsFn, class MoveFn>
+void ParticleSystem::Apply(int existenceChecks, int interval, int frame, std::vector<int>& deadOut, ExistsFn&& exists, MoveFn&& move) {
+    const int n = Size();
+    if (n == 0) return;
+
+    // Props are mission entities we own, so checking a rotating slice is enough
+    int checks = existenceChecks < n ? existenceChecks : n;
+    for (int c = 0; c < checks; c++) {
+        int i = m_checkCursor;
+        m_checkCursor = (m_checkCursor + 1) % n;
+
+        if (m_alive[i] && !exists(m_props[i])) {
+            m_alive[i] = 0;
+            deadOut.push_back(i);
+        }
+    }
+
+    if (interval < 1) interval = 1;
+    for (int i = 0; i < n; i++) {
+        if (!m_alive[i]) continue;
+        if ((m_layer[i] + frame) % interval != 0) continue;
+        move(m_props[i], m_outX[i], m_outY[i], m_outZ[i]);
+    }
+}
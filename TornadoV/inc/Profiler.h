@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// Scoped hot-path timing zones. Build with TORNADOV_PROFILE defined (Debug does)
+// to enable them; otherwise TV_PROFILE_ZONE and TV_PROFILE_END_FRAME compile to nothing.
+//
+//     void TornadoVortex::UpdatePulledEntities(...) {
+//         TV_PROFILE_ZONE("Vortex::UpdatePulledEntities");
+//
+// A zone hit several times in one frame (once per vortex, say) sums into that
+// frame's sample. The last WindowSize frames feed the min/avg/p99 stats.
+class Profiler {
+public:
+    static const int MaxZones = 32;
+    static const int WindowSize = 256;
+
+    struct ZoneStats {
+        const char* name;
+        int samples;
+        float callsPerFrame;
+        float minUs;
+        float avgUs;
+        float p99Us;
+        float maxUs;
+    };
+
+    static int RegisterZone(const char* name);
+    static void Record(int zone, uint64_t ticks);
+    static void EndFrame();
+
+    // QueryPerformanceCounter ticks on Windows, steady_clock elsewhere
+    static uint64_t Now();
+    static double TicksToMicroseconds(uint64_t ticks);
+
+    static int GetZoneCount() { return m_zoneCount; }
+    static ZoneStats GetStats(int zone);
+    static bool WriteCsv(const std::string& path);
+
+private:
+    static const char* m_names[MaxZones];
+    static uint64_t m_frameTicks[MaxZones];
+    static int m_frameCalls[MaxZones];
+    static float m_historyUs[MaxZones][WindowSize];
+    static int m_historyCalls[MaxZones][WindowSize];
+    static int m_zoneCount;
+    static int m_frameIndex;
+    static int m_framesRecorded;
+};
+
+class ProfileScope {
+public:
+    explicit ProfileScope(int zone) : m_zone(zone), m_start(Profiler::Now()) {}
+    ~ProfileScope() { Profiler::Record(m_zone, Profiler::Now() - m_start); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    int m_zone;
+    uint64_t m_start;
+};
+
+#define TV_PROFILE_CONCAT_INNER(a, b) a##b
+#define TV_PROFILE_CONCAT(a, b) TV_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef TORNADOV_PROFILE
+#define TV_PROFILE_ZONE(name) \
+    static const int TV_PROFILE_CONCAT(_tvZoneId, __LINE__) = Profiler::RegisterZone(name); \
+    ProfileScope TV_PROFILE_CONCAT(_tvZone, __LINE__)(TV_PROFILE_CONCAT(_tvZoneId, __LINE__))
+#define TV_PROFILE_END_FRAME() Profiler::EndFrame()
+#else
+#define TV_PROFILE_ZONE(name) ((void)0)
+#define TV_PROFILE_END_FRAME() ((void)0)
+#endif
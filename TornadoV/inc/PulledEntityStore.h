@@ -0,0 +1,63 @@
+#pragma once
+#include <vector>
+#include "types.h"
+
+// Dense structure-of-arrays store for the entities a vortex is holding.
+// Handles resolve to slots through an open-addressing table and removal swaps
+// the last slot into the hole, so the parallel arrays always stay packed.
+// Removing slot i while walking from Size() - 1 down to 0 is safe.
+class PulledEntityStore {
+public:
+    PulledEntityStore();
+
+    int Size() const { return (int)m_handles.size(); }
+    bool Contains(Entity handle) const { return Find(handle) != -1; }
+    int Find(Entity handle) const;
+
+    int Add(Entity handle, float xBias, float yBias, bool isPlayer, unsigned char classification);
+    void RemoveAt(int index);
+    bool Remove(Entity handle);
+    void Clear();
+
+    Entity Handle(int index) const { return m_handles[index]; }
+    float XBias(int index) const { return m_xBias[index]; }
+    float YBias(int index) const { return m_yBias[index]; }
+    bool IsPlayer(int index) const { return m_isPlayer[index] != 0; }
+    unsigned char Classification(int index) const { return m_class[index]; }
+
+    // Frames since the entity last got its forces applied
+    int Starvation(int index) const { return m_starved[index]; }
+    void AgeAll();
+    void MarkServed(int index) { m_starved[index] = 0; }
+
+    Vector3 GetPosition(int index) const;
+    void SetPosition(int index, const Vector3& position);
+
+    const float* PositionsX() const { return m_posX.data(); }
+    const float* PositionsY() const { return m_posY.data(); }
+    const float* PositionsZ() const { return m_posZ.data(); }
+    const float* XBiases() const { return m_xBias.data(); }
+    const float* YBiases() const { return m_yBias.data(); }
+
+private:
+    static constexpr int EmptySlot = -1;
+
+    int SlotOf(Entity handle) const;
+    int HomeSlot(Entity handle) const;
+    void EraseSlot(int slot);
+    void Rehash(int capacity);
+
+    std::vector<Entity> m_handles;
+    std::vector<float> m_xBias;
+    std::vector<float> m_yBias;
+    std::vector<unsigned char> m_isPlayer;
+    std::vector<unsigned char> m_class;
+    std::vector<int> m_starved;
+    std::vector<float> m_posX;
+    std::vector<float> m_posY;
+    std::vector<float> m_posZ;
+
+    std::vector<int> m_table; // Slot -> dense index, EmptySlot when free
+    int m_mask;
+    int m_shift; // 32 - log2(table size), so HomeSlot keeps the top bits of the product
+};
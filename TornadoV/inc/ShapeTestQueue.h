@@ -0,0 +1,65 @@
+#pragma once
+#include <deque>
+#include <unordered_map>
+#include <vector>
+#include "types.h"
+
+// Asynchronous line-of-sight probes shared by every vortex.
+// Vortices ask whether an entity is sheltered from the core; the ray is
+// queued, started with _START_SHAPE_TEST_RAY on the next Update() and its
+// result harvested with _GET_RAYCAST_RESULT on a later frame, so the game
+// never has to answer a physics query synchronously. A per-frame budget caps
+// how many probes are started, and each entity's last answer is reused until
+// it goes stale.
+class ShapeTestQueue {
+public:
+    // Once per frame, before the vortices: collects finished probes, then
+    // starts queued ones within the budget
+    void Update(int gameTime);
+
+    // Queues a probe from -> to for entity unless one is in flight or its last
+    // result is younger than RESULT_TTL_MS. Cheap to call every frame.
+    void Request(Entity entity, const Vector3& from, const Vector3& to, int gameTime);
+
+    // Last harvested answer; false until the first probe for entity completes
+    bool IsSheltered(Entity entity) const;
+
+    // Forgets every probe. Handles still in flight are kept and polled by
+    // Update() until the game is done with them, so none are leaked.
+    void Clear();
+    // Includes probes dropped by Clear() that the game hasn't finished yet
+    int GetInFlightCount() const { return (int)(m_inFlight.size() + m_orphans.size()); }
+    // Update() still has handles to collect
+    bool HasPending() const { return !m_inFlight.empty() || !m_orphans.empty() || !m_queue.empty(); }
+
+private:
+    enum class ProbeState : unsigned char {
+        Idle,
+        Queued,
+        InFlight
+    };
+
+    struct Probe {
+        ProbeState state = ProbeState::Idle;
+        int handle = 0;
+        Vector3 from;
+        Vector3 to;
+        bool hasResult = false;
+        bool hit = false;
+        int resultTime = 0;
+        int lastRequest = 0;
+    };
+
+    static const int PROBES_PER_FRAME = 6;
+    static const int MAX_IN_FLIGHT = 24;
+    static const int RESULT_TTL_MS = 1000;  // Same cadence as the old synchronous player ray
+    static const int FORGET_AFTER_MS = 5000; // Entities nobody asked about for this long are dropped
+
+    void Sweep(int gameTime);
+
+    std::unordered_map<Entity, Probe> m_probes;
+    std::deque<Entity> m_queue;
+    std::vector<Entity> m_inFlight;
+    std::vector<int> m_orphans; // Handles of in-flight probes dropped by Clear()
+    int m_lastSweep = 0;
+};
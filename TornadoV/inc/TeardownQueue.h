@@ -0,0 +1,49 @@
+#pragma once
+#include <deque>
+#include <memory>
+#include <vector>
+#include "AssetCache.h"
+#include "FrameBudget.h"
+
+class TornadoParticle;
+
+// Deferred destruction of despawned funnels, shared by every vortex.
+// A retiring vortex hands over its particles top-down; each one fades its
+// effect out over FADE_MS and is then disposed (FX stopped, prop returned to
+// the pool), a few per frame within the frame budget, so removing a whole
+// tornado never costs hundreds of native calls in one frame. The vortex's
+// asset references are held until its last particle is gone.
+class TeardownQueue {
+public:
+    TeardownQueue();
+    ~TeardownQueue(); // Flushes
+
+    // Takes ownership; particles are retired in the order given
+    void Push(std::vector<std::unique_ptr<TornadoParticle>> particles, std::vector<AssetCache::Key> assets);
+
+    // Once per frame: advances the fades and disposes what has faded out
+    void Update(int gameTime, const FrameBudget& budget);
+
+    // Disposes everything left immediately, for shutdown
+    void Flush();
+
+    bool IsEmpty() const { return m_queue.empty(); }
+    int GetPendingCount() const { return (int)m_queue.size(); }
+
+private:
+    struct Retiring {
+        std::unique_ptr<TornadoParticle> particle; // Null for a vortex that had none
+        std::vector<AssetCache::Key> assets;       // Only on the last entry of each vortex
+        int fadeStart = -1;                        // -1 until it enters the fade window
+    };
+
+    static constexpr int FADE_MS = 400;             // 0 disposes without fading
+    static constexpr int FADE_STEPS = 4;            // Alpha changes per particle, so SET_PARTICLE_FX_LOOPED_ALPHA isn't sent every frame
+    static constexpr int FADE_WINDOW = 48;          // Particles fading at once
+    static constexpr int RETIRES_PER_FRAME = 16;
+    static constexpr int MIN_RETIRES_PER_FRAME = 2; // Still drains when the vortices used up the budget
+
+    static void Retire(Retiring& entry);
+
+    std::deque<Retiring> m_queue;
+};
@@ -3,27 +3,54 @@
 #include <memory>
 #include "types.h"
 #include "TornadoVortex.h"
+#include "EntityGrid.h"
+#include "EntityClaims.h"
+#include "EntityFrameCache.h"
+#include "ShapeTestQueue.h"
+#include "TeardownQueue.h"
+#include "ParticlePropPool.h"
+#include "FrameBudget.h"
+#include "TornadoSettings.h"
+#include "FrameContext.h"
 
 class TornadoFactory {
 public:
-    TornadoFactory();
+    // settings is used until the first OnUpdate hands in a newer snapshot
+    explicit TornadoFactory(const TornadoSettings& settings);
     ~TornadoFactory();
 
     TornadoVortex* CreateVortex(Vector3 position);
-    void OnUpdate(int gameTime);
+    // frame and settings are this frame's snapshots; both are kept for spawns made from the menu between updates
+    void OnUpdate(const FrameContext& frame, const TornadoSettings& settings, const FrameBudget& budget);
     void RemoveAll();
-    void RefreshAllVortexSettings();
     void Dispose();
 
     int GetActiveVortexCount() const { return (int)m_activeVortexList.size(); }
+    bool IsTearingDown() const { return !m_teardown.IsEmpty(); }
     TornadoVortex* GetFirstVortex() { return m_activeVortexList.empty() ? nullptr : m_activeVortexList.front().get(); }
 
 private:
+    void RebuildEntityGrid();
+    void UpdateParticles(const TornadoSettings& settings);
+
     static const int VortexLimit = 30;
     static const int TornadoSpawnDelayBase = 20000;
     static const int SPAWN_COOLDOWN = 2000;
+    // Shared by all vortices in the particle pass, so extra vortices thin each other out
+    static const int PROP_MOVES_PER_FRAME = 1024;
+    static const int EXISTENCE_CHECKS_PER_FRAME = 32;
+    static constexpr int MIN_EXISTENCE_CHECKS = 4;
 
+    ParticlePropPool m_propPool; // Declared first so it outlives the vortices
+    EntityClaims m_entityClaims; // Same; vortices release their claims on Dispose
+    ShapeTestQueue m_shapeTests;
+    TeardownQueue m_teardown; // Despawned funnels drain here while new ones may spawn
     std::vector<std::unique_ptr<TornadoVortex>> m_activeVortexList;
+    EntityGrid m_entityGrid;
+    EntityFrameCache m_entityCache;
+    int m_budgetCursor;
+    TornadoSettings m_settings;
+    FrameContext m_frame;
     
     int m_spawnDelayAdditive;
     int m_spawnDelayStartTime;
@@ -2,6 +2,8 @@
 
 #include "types.h"
 #include "XmlHelper.h"
+#include "TornadoSettings.h"
+#include "FrameContext.h"
 #include <string>
 #include <vector>
 #include <functional>
@@ -52,7 +54,13 @@ struct Submenu {
 class TornadoMenu {
 public:
     static void Initialize();
-    static void OnTick();
+    // Re-read the statics from the resident config (startup and hot reload)
+    static void LoadIniSettings();
+    static void LoadXmlSettings();
+    // Snapshot of the statics below that the factory and vortices run on; rebuilt per call,
+    // version bumped whenever a value changed since the previous call
+    static const TornadoSettings& GetSettings();
+    static void OnTick(const FrameContext& frame);
     static void OnKeyDown(DWORD key);
     
     static bool IsVisible() { return m_visible; }
@@ -94,6 +102,10 @@ public:
     static float m_vortexVerticalForceScale;
     static float m_vortexHorizontalForceScale;
     static float m_vortexMaxEntitySpeed;
+    static float m_vortexFrameBudget;
+    static int m_propPoolSize;
+    static bool m_multiVortex; // Allow spawning while another tornado is active
+    static bool m_profilerOverlay; // Only drawn in TORNADOV_PROFILE builds
 
     // Tornado customization settings
     static float m_tornadoSpawnDistance;
@@ -115,6 +127,7 @@ public:
 
 private:
     static void DrawMenu();
+    static void DrawProfilerOverlay();
     static void HandleInput();
     static void DrawRect(float x, float y, float width, float height, int r, int g, int b, int a);
     static void DrawText(std::string text, float x, float y, float scale, int font, int r, int g, int b, int a, bool center = false, bool right = false, bool outline = false);
@@ -130,7 +143,9 @@ public:
     static void SpawnTornado();
     static void DespawnTornado();
     static void TeleportToTornado();
-    static void RefreshVortexSettings();
+    static void RunBenchmarks();
+    static void DumpProfilerCsv();
+    static void DumpNativeStats();
 
 private:
     static bool m_visible;
@@ -160,6 +175,9 @@ private:
     static DWORD m_lastRepeatTime;
     static int m_repeatCount;
 
+    static TornadoSettings m_settings;
+    static FrameContext m_frame; // Last OnTick's; spawn and teleport run from it
+
     static const float MENU_WIDTH;
     static const float TITLE_HEIGHT;
     static const float OPTION_HEIGHT;
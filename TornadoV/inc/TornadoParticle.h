@@ -5,41 +5,44 @@
 #include <memory>
 
 class TornadoVortex;
+class ParticlePropPool;
 
 class TornadoParticle {
 public:
     TornadoParticle(TornadoVortex* vortex, Vector3 position, Vector3 angle, 
                    const std::string& fxAsset, const std::string& fxName, 
-                   float radius, int layerIdx, bool isCloud = false);
+                   float radius, int layerIdx, float layerSeparation, int maxLayers, bool isCloud = false);
     ~TornadoParticle();
 
-    void OnUpdate(int gameTime);
     void StartFx(float scale);
     void RemoveFx();
     void Dispose();
 
+    // Far LOD: odd upper layers fade out and the rest grow to cover the gaps
+    void SetReducedDetail(bool reduced);
+    // Teardown fade; never raises the alpha, so faded-out LOD layers stay hidden
+    void FadeTo(float alpha);
+
+    // Orbit parameters handed to the vortex ParticleSystem, which moves the prop
+    const Quaternion& GetRotation() const { return _rotation; }
+    float GetRadius() const { return _radius; }
+    float GetOffsetZ() const { return _offset.z; }
+    float GetAngularRate() const { return IsCloud ? 0.16f : _layerMask; }
+
     Entity Ref; // In C# this is 'Ref' from ScriptEntity
     int LayerIndex;
     TornadoVortex* Parent;
     bool IsCloud;
 
 private:
-    static Entity SafeSetup(Vector3 position);
-    void PostSetup();
-    void RefreshCache();
+    void PostSetup(int maxLayers);
 
-    Vector3 _centerPos;
+    ParticlePropPool* _propPool;
     Vector3 _offset;
     Quaternion _rotation;
     std::unique_ptr<LoopedParticle> _ptfx;
     float _radius;
-    float _angle;
     float _layerMask;
-
-    float _cachedRotationSpeed;
-    float _cachedLayerSeparation;
-    int _lastCacheTime;
-
-    int _updateSkipCounter;
-    static const int UPDATE_SKIP_FREQUENCY = 2;
+    float _baseScale;
+    bool _reducedDetail;
 };
@@ -0,0 +1,55 @@
+#pragma once
+
+// Plain copy of every setting the factory and vortices read while running.
+// TornadoMenu rebuilds it from its statics once per frame and bumps version
+// when anything changed; script update() hands it down by const reference, so
+// physics code never reads the menu globals and hot loops can keep the few
+// values they need in locals.
+struct TornadoSettings {
+    unsigned int version = 0;
+
+    // Movement
+    bool movementEnabled = true;
+    bool followPlayer = true;
+    float moveSpeedScale = 1.0f;
+
+    // Entity pulling
+    float maxEntityDistance = 57.0f;
+    int maxEntityCount = 200;
+    float verticalForceScale = 2.29f;
+    float horizontalForceScale = 1.7f;
+    float maxEntitySpeed = 40.0f;
+    bool affectPlayer = true;
+    float frameBudgetMs = 3.0f;
+
+    // Funnel
+    float vortexRadius = 9.4f;
+    int particlesPerLayer = 9;
+    int maxParticleLayers = 48;
+    float layerSeparation = 22.0f;
+    float rotationSpeed = 2.4f;
+    bool reverseRotation = false;
+    bool cloudTopEnabled = true;
+    bool particleMod = true;
+    int propPoolSize = 512;
+    float lodDistance = 500.0f;
+    bool drawBlip = true;
+
+    // Spawning
+    bool notifications = true;
+    bool spawnInStorm = true;
+    bool spawnInFront = true;
+    float tornadoSpawnDistance = 100.0f;
+
+    // Audio
+    bool enableTornadoSound = true;
+    float tornadoVolume = 1.0f;
+    bool enableSirens = true;
+    float sirenVolume = 1.0f;
+    bool enableEAS = true;
+    float easVolume = 1.0f;
+
+    float SignedRotationSpeed() const { return reverseRotation ? -rotationSpeed : rotationSpeed; }
+
+    bool operator==(const TornadoSettings&) const = default;
+};
@@ -1,56 +1,138 @@
 #pragma once
 #include <vector>
-#include <map>
 #include <memory>
 #include "types.h"
 #include "MathEx.h"
 #include "LoopedParticle.h"
+#include "EntityGrid.h"
+#include "PulledEntityStore.h"
+#include "ForceKernel.h"
+#include "FrameBudget.h"
+#include "ParticleSystem.h"
+#include "AssetCache.h"
+#include "EntityClaims.h"
+#include "EntityFrameCache.h"
+#include "ShapeTestQueue.h"
+#include "TeardownQueue.h"
+#include "TornadoSettings.h"
+#include "FrameContext.h"
 
 class TornadoParticle;
+class ParticlePropPool;
 
 struct ActiveEntity {
     Entity entity;
     float xBias;
     float yBias;
     bool isPlayer;
+    unsigned char classification; // EntityClassifier bits, decided at capture
 
-    ActiveEntity() : entity(0), xBias(0), yBias(0), isPlayer(false) {}
-    ActiveEntity(Entity ent, float x, float y, bool player) 
-        : entity(ent), xBias(x), yBias(y), isPlayer(player) {}
+    ActiveEntity() : entity(0), xBias(0), yBias(0), isPlayer(false), classification(0) {}
+    ActiveEntity(Entity ent, float x, float y, bool player, unsigned char cls) 
+        : entity(ent), xBias(x), yBias(y), isPlayer(player), classification(cls) {}
+};
+
+enum class BuildState {
+    RequestAssets,
+    WaitAssets,
+    CreateParticles,
+    Done
+};
+
+// Detail level picked from the camera distance against TornadoSettings::lodDistance
+enum class VortexLod {
+    Near, // Every particle moved every frame
+    Mid,  // Layers take turns, half the props move per frame
+    Far   // A quarter of the props per frame, merged upper layers, slower entity scans
 };
 
 class TornadoVortex {
 public:
-    TornadoVortex(Vector3 initialPosition, bool neverDespawn);
+    TornadoVortex(Vector3 initialPosition, bool neverDespawn, ParticlePropPool* propPool, EntityClaims* claims, ShapeTestQueue* shapeTests,
+                  const TornadoSettings& settings, const FrameContext& frame);
     ~TornadoVortex();
 
-    void Build();
-    void OnUpdate(int gameTime);
+    // Advances the build by one step; never waits, call once per frame until IsBuilt()
+    void StepBuild(const TornadoSettings& settings, const FrameBudget& budget);
+    bool IsBuilt() const { return _build.state == BuildState::Done; }
+    void OnUpdate(const FrameContext& frame, const TornadoSettings& settings, const EntityGrid& entityGrid, EntityFrameCache& entityCache, const FrameBudget& budget);
+    // Particle half of the frame, run by the factory for all vortices in one pass after
+    // the entity work. angleStep is rotation speed times frame time; the factory shares
+    // out the existence checks and can force a coarser layer interval than the LOD's.
+    void UpdateParticles(float angleStep, int existenceChecks, int minInterval);
     void Dispose();
+    // Like Dispose(), but the particles and their assets go to the teardown queue
+    // top-down instead of being destroyed this frame
+    void Retire(TeardownQueue& teardown);
 
     Vector3 Position;
     bool DespawnRequested;
 
-    void ChangeDestination(bool trackToPlayer);
+    void ChangeDestination(bool trackToPlayer, const Vector3& playerPos);
     Vector3 GetPosition() const { return Position; }
-    void RefreshCachedVars();
+    ParticlePropPool* GetPropPool() const { return _propPool; }
+    bool WantsEntityScan(int gameTime, int maxEntityCount) const;
+    VortexLod GetLod() const { return _lod; }
+    int GetId() const { return _id; }
+    int GetParticleCount() const { return _particleSystem.Size(); }
+
+    // The entity grid is queried this far beyond MaxEntityDistance
+    static constexpr float SCAN_MARGIN = 5.0f;
 
 private:
-    void CollectNearbyEntities(int gameTime, float maxDistanceDelta);
-    void UpdatePulledEntities(int gameTime, float maxDistanceDelta);
-    void AddEntity(ActiveEntity entity);
-    void ReleaseEntity(int entityHandle);
+    // Resumable state of StepBuild between frames
+    struct BuildJob {
+        BuildState state = BuildState::RequestAssets;
+        std::string particleAsset;
+        std::string particleName;
+        bool enableClouds = false;
+        bool particleMod = false;
+        int layers = 0;
+        int maxLayers = 1; // Uncapped setting, used for the particles' angular falloff
+        int particleCount = 1;
+        int multiplier = 360;
+        float radius = 0.0f;
+        float particleSize = 0.0f;
+        float layerSepScale = 0.0f;
+        int layerIdx = 0;
+        int angle = 0;
+    };
+
+    void BeginBuild(const TornadoSettings& settings);
+    bool CreateNextParticle();
+    void AddParticle(std::unique_ptr<TornadoParticle> particle);
+    void UpdateLod(float lodDistance, const Vector3& camPos);
+
+    void CollectNearbyEntities(const FrameContext& frame, const TornadoSettings& settings, const EntityGrid& entityGrid, EntityFrameCache& entityCache, const FrameBudget& budget);
+    void UpdatePulledEntities(const FrameContext& frame, const TornadoSettings& settings, EntityFrameCache& entityCache, const FrameBudget& budget);
+    void AddEntity(ActiveEntity entity, const Vector3& position, EntityFrameCache& entityCache);
+
+    int _id; // Spawn sequence number, used to attribute native call stats
+    static int s_nextId;
 
     std::vector<std::unique_ptr<TornadoParticle>> _particles;
+    ParticleSystem _particleSystem; // Same indices as _particles
+    std::vector<int> _deadParticles;
+    VortexLod _lod;
+    int _lodFrame;
+    ParticlePropPool* _propPool;
+    EntityClaims* _claims;
+    ShapeTestQueue* _shapeTests;
+    BuildJob _build;
+    std::vector<AssetCache::Key> _assets; // AssetCache keys held for the vortex lifetime
+    static const int MAX_PARTICLES_PER_BUILD_STEP = 10;
     int _aliveTime;
     int _createdTime;
     int _nextUpdateTime;
     int _lastFullUpdateTime;
     int _lifeSpan;
     
-    std::map<int, ActiveEntity> _pulledEntities;
-    std::vector<int> _pendingRemovalEntities;
-    std::vector<std::pair<int, ActiveEntity>> _entitySnapshot;
+    PulledEntityStore _pulledEntities;
+    ForceBatch _forceBatch;
+    std::vector<std::pair<float, int>> _serveOrder;
+    std::vector<Entity> _releaseList;
+    float _entityCostMicros;
+    std::vector<int> _gridCandidates;
 
     Vector3 _position;
     Vector3 _destination;
@@ -58,19 +140,12 @@ private:
 
     float ForceScale = 3.0f;
     float InternalForcesDist = 5.0f;
-    float MaxEntityDist = 57.0f;
-
-    int _lastPlayerShapeTestTime;
-    bool _lastRaycastResultFailed;
-
-    float _cachedVerticalForce;
-    float _cachedHorizontalForce;
-    float _cachedTopSpeed;
-    int _lastVarCacheTime;
 
     int _updateFrameCounter;
     static const int PARTICLE_UPDATE_INTERVAL = 2;
-    int MaxEntityCount = 200;
+    static constexpr int MIN_ENTITIES_PER_FRAME = 8;
+    static const int MIN_ADDS_PER_TICK = 4;
+    static constexpr float STARVATION_WEIGHT = 10.0f; // Metres of priority gained per skipped frame
 
     // Helper for blip (not in C# but needed for SHV)
     Blip m_blip;
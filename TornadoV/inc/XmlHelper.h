@@ -3,6 +3,14 @@
 #include <vector>
 #include <Windows.h>
 
+#include <memory>
+
+namespace tinyxml2 { class XMLElement; class XMLDocument; }
+
+// menu_config.xml is parsed once in Initialize and kept resident.
+// Reads resolve dotted paths through a cached path->element index, and writes
+// only edit the in-memory document; Update() saves on a background thread
+// once writes have been quiet for a moment, so dragging a slider costs one save.
 class XmlHelper {
 public:
     // Color helper
@@ -13,6 +21,14 @@ public:
     static void Initialize(HMODULE hModule = NULL);
     static void DeployDefaultConfig(HMODULE hModule);
     static void ValidateAndRepairXml();
+    static void Reload();
+    // Swaps in a document parsed elsewhere (hot reload); unsaved menu edits are dropped
+    static void Adopt(std::shared_ptr<tinyxml2::XMLDocument> doc);
+
+    // Once per frame: hands a pending save to the writer thread when it's due
+    static void Update();
+    // Writes any unsaved changes synchronously
+    static void Shutdown();
     
     // Generic value getters
     static std::string GetString(const std::string& path, const std::string& defaultValue = "");
@@ -28,6 +44,11 @@ public:
 
     static std::string GetXmlPath() { return XmlPath; }
 
+    static bool WriteFile(const std::string& text);
+
 private:
+    static tinyxml2::XMLElement* Resolve(const std::string& path, bool create);
+    static void MarkDirty();
+
     static std::string XmlPath;
 };
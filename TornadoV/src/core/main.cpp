@@ -2,6 +2,9 @@
 #include "script.h"
 #include "keyboard.h"
 #include "Logger.h"
+#include "IniHelper.h"
+#include "XmlHelper.h"
+#include "ConfigWatcher.h"
 
 BOOL APIENTRY DllMain(HMODULE hModule, DWORD  ul_reason_for_call, LPVOID /*lpReserved*/) {
     switch (ul_reason_for_call) {
@@ -13,6 +16,10 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD  ul_reason_for_call, LPVOID /*lpRes
     case DLL_PROCESS_DETACH:
         scriptUnregister(hModule);
         keyboardHandlerUnregister(OnKeyboardMessage);
+        ConfigWatcher::Stop();
+        IniHelper::Shutdown();
+        XmlHelper::Shutdown();
+        Logger::Shutdown();
         break;
     }
     return TRUE;
@@ -7,6 +7,12 @@
 #include "keyboard.h"
 #include "Logger.h"
 #include "AudioManager.h"
+#include "FrameBudget.h"
+#include "FrameContext.h"
+#include "AssetCache.h"
+#include "ConfigWatcher.h"
+#include "Profiler.h"
+#include "NativeStats.h"
 #include "resource.h"
 #include <string>
 #include <memory>
@@ -62,21 +68,61 @@ void Bootstrap() {
     ExtractResource(IDR_WAV_SIREN,   sounds / "tornado-weather-alert.wav");
 }
 
+static FrameContext CaptureFrameContext() {
+    FrameContext frame;
+    frame.gameTime = GAMEPLAY::GET_GAME_TIMER();
+    frame.frameTime = GAMEPLAY::GET_FRAME_TIME();
+
+    frame.playerPed = PLAYER::PLAYER_PED_ID();
+    frame.playerVehicle = PED::GET_VEHICLE_PED_IS_IN(frame.playerPed, false);
+    frame.playerPos = ENTITY::GET_ENTITY_COORDS(frame.playerPed, true);
+
+    frame.camPos = CAM::GET_GAMEPLAY_CAM_COORD();
+    frame.camRot = CAM::GET_GAMEPLAY_CAM_ROT(2);
+    frame.camForward = MathEx::RotationToDirection(frame.camRot);
+
+    frame.rainLevel = GAMEPLAY::GET_RAIN_LEVEL();
+    return frame;
+}
+
 void update() {
-    int gameTime = GAMEPLAY::GET_GAME_TIMER();
+    // Read the game's per-frame state once; everything below works from this copy
+    const FrameContext frame = CaptureFrameContext();
+
+    // Adopt config files edited outside the game before anything reads settings
+    ConfigWatcher::Apply();
     
+    // Settings as of this frame; everything below the factory reads this copy, not the menu
+    TornadoSettings settings = TornadoMenu::GetSettings();
+
+    // Per-frame time slice for vortex entity work, shared out by the factory
+    FrameBudget vortexBudget(settings.frameBudgetMs * 1000.0f);
+
+    // One streaming poll per frame for every asset the vortices are waiting on
+    {
+        TV_PROFILE_ZONE("AssetCache::Update");
+        AssetCache::Get().Update();
+    }
+
     if (g_Factory) {
-        g_Factory->OnUpdate(gameTime);
+        g_Factory->OnUpdate(frame, settings, vortexBudget);
     }
     
     // Update Audio Listener
-    Vector3 camPos = CAM::GET_GAMEPLAY_CAM_COORD();
-    Vector3 camRot = CAM::GET_GAMEPLAY_CAM_ROT(2);
-    Vector3 forward = MathEx::RotationToDirection(camRot);
-    AudioManager::Get().UpdateListener(camPos.x, camPos.y, camPos.z, forward.x, forward.y, forward.z, 0, 0, 1);
+    AudioManager::Get().UpdateListener(frame.camPos.x, frame.camPos.y, frame.camPos.z, frame.camForward.x, frame.camForward.y, frame.camForward.z, 0, 0, 1);
 
     // Logger::Log("Calling Menu::OnTick");
-    TornadoMenu::OnTick();
+    {
+        TV_PROFILE_ZONE("Menu::OnTick");
+        TornadoMenu::OnTick(frame);
+    }
+
+    // Debounced saves of TornadoV.ini and menu_config.xml edits made this frame
+    IniHelper::Update();
+    XmlHelper::Update();
+
+    TV_PROFILE_END_FRAME();
+    TV_NATIVE_END_FRAME();
 }
 
 void ModMain() {
@@ -110,8 +156,9 @@ void ModMain() {
         AudioManager::Get().LoadSound("city_siren", folder + "\\tornado-weather-alert.wav");
 
         TornadoMenu::Initialize();
+        ConfigWatcher::Start(IniHelper::GetIniPath(), XmlHelper::GetXmlPath());
         
-        g_Factory = std::make_unique<TornadoFactory>();
+        g_Factory = std::make_unique<TornadoFactory>(TornadoMenu::GetSettings());
         
         Logger::Log("Tornado V Enhanced initialized successfully.");
         
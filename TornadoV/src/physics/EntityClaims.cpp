@@ -0,0 +1,17 @@
+#include "EntityClaims.h"
+
+int EntityClaims::OwnerOf(Entity handle) const {
+    auto it = m_owners.find(handle);
+    return it != m_owners.end() ? it->second : NoOwner;
+}
+
+void EntityClaims::Claim(Entity handle, int owner) {
+    m_owners[handle] = owner;
+}
+
+void EntityClaims::Release(Entity handle, int owner) {
+    auto it = m_owners.find(handle);
+    if (it != m_owners.end() && it->second == owner) {
+        m_owners.erase(it);
+    }
+}
@@ -0,0 +1,61 @@
+#include "EntityClassifier.h"
+#include "NativeStats.h"
+#include "natives.h"
+#include <unordered_map>
+
+namespace {
+
+// Vehicle model hash -> packed bits (without the kind); script thread only
+std::unordered_map<Hash, unsigned char> g_modelClasses;
+
+// GET_VEHICLE_CLASS_FROM_NAME values
+const int VEHICLE_CLASS_MOTORCYCLE = 8;
+const int VEHICLE_CLASS_INDUSTRIAL = 10;
+const int VEHICLE_CLASS_CYCLE = 13;
+const int VEHICLE_CLASS_SERVICE = 17;
+const int VEHICLE_CLASS_MILITARY = 19;
+const int VEHICLE_CLASS_COMMERCIAL = 20;
+
+} // namespace
+
+unsigned char EntityClassifier::Classify(EntityKind kind, Hash model) {
+    unsigned char packed = (unsigned char)kind;
+    if (kind == EntityKind::Vehicle) {
+        return packed | ClassifyVehicleModel(model);
+    }
+    return packed | ((unsigned char)MassClass::Light << MASS_SHIFT);
+}
+
+unsigned char EntityClassifier::ClassifyVehicleModel(Hash model) {
+    auto it = g_modelClasses.find(model);
+    if (it != g_modelClasses.end()) return it->second;
+
+    unsigned char bits = 0;
+    if (TV_NATIVE(VEHICLE::IS_THIS_MODEL_A_PLANE(model))) bits |= PLANE;
+    if (TV_NATIVE(VEHICLE::IS_THIS_MODEL_A_HELI(model))) bits |= HELI;
+    if (TV_NATIVE(VEHICLE::IS_THIS_MODEL_A_BOAT(model))) bits |= BOAT;
+
+    MassClass mass = MassClass::Medium;
+    switch (TV_NATIVE(VEHICLE::GET_VEHICLE_CLASS_FROM_NAME(model))) {
+    case VEHICLE_CLASS_MOTORCYCLE:
+    case VEHICLE_CLASS_CYCLE:
+        mass = MassClass::Light;
+        break;
+    case VEHICLE_CLASS_INDUSTRIAL:
+    case VEHICLE_CLASS_SERVICE:
+    case VEHICLE_CLASS_MILITARY:
+    case VEHICLE_CLASS_COMMERCIAL:
+        mass = MassClass::Heavy;
+        break;
+    default:
+        break;
+    }
+    bits |= (unsigned char)mass << MASS_SHIFT;
+
+    g_modelClasses.emplace(model, bits);
+    return bits;
+}
+
+int EntityClassifier::GetKnownModelCount() {
+    return (int)g_modelClasses.size();
+}
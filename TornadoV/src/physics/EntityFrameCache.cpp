@@ -0,0 +1,92 @@
+#include "EntityFrameCache.h"
+#include "NativeStats.h"
+#include "natives.h"
+
+EntityFrameCache::EntityFrameCache()
+    : m_table(1024), m_mask(1023), m_live(0), m_frame(1) {
+}
+
+void EntityFrameCache::BeginFrame() {
+    m_frame++;
+    m_live = 0;
+}
+
+int EntityFrameCache::HomeSlot(Entity entity) const {
+    // Same Fibonacci hashing as PulledEntityStore
+    return (int)(((unsigned int)entity * 2654435769u) >> 7) & m_mask;
+}
+
+EntityFrameCache::Entry& EntityFrameCache::Lookup(Entity entity) {
+    // Nothing is removed within a frame, so a stale slot ends the probe chain
+    int slot = HomeSlot(entity);
+    while (m_table[slot].frame == m_frame) {
+        if (m_table[slot].handle == entity)
+            return m_table[slot];
+        slot = (slot + 1) & m_mask;
+    }
+
+    // Keep the load factor at or below one half
+    if ((m_live + 1) * 2 > (int)m_table.size()) {
+        Grow();
+        return Lookup(entity);
+    }
+
+    Entry& entry = m_table[slot];
+    entry = Entry();
+    entry.handle = entity;
+    entry.frame = m_frame;
+    m_live++;
+    return entry;
+}
+
+void EntityFrameCache::Grow() {
+    std::vector<Entry> old;
+    old.swap(m_table);
+    m_table.assign(old.size() * 2, Entry());
+    m_mask = (int)m_table.size() - 1;
+
+    for (const Entry& entry : old) {
+        if (entry.frame != m_frame) continue;
+        int slot = HomeSlot(entry.handle);
+        while (m_table[slot].frame == m_frame) {
+            slot = (slot + 1) & m_mask;
+        }
+        m_table[slot] = entry;
+    }
+}
+
+bool EntityFrameCache::Exists(Entity entity) {
+    Entry& entry = Lookup(entity);
+    if (!(entry.known & HasExists)) {
+        entry.exists = TV_NATIVE(ENTITY::DOES_ENTITY_EXIST(entity)) != 0;
+        entry.known |= HasExists;
+    }
+    return entry.exists;
+}
+
+Vector3 EntityFrameCache::Coords(Entity entity) {
+    Entry& entry = Lookup(entity);
+    if (!(entry.known & HasCoords)) {
+        entry.coords = TV_NATIVE(ENTITY::GET_ENTITY_COORDS(entity, true));
+        entry.known |= HasCoords;
+    }
+    return entry.coords;
+}
+
+float EntityFrameCache::HeightAboveGround(Entity entity) {
+    Entry& entry = Lookup(entity);
+    if (!(entry.known & HasHeight)) {
+        entry.height = TV_NATIVE(ENTITY::GET_ENTITY_HEIGHT_ABOVE_GROUND(entity));
+        entry.known |= HasHeight;
+    }
+    return entry.height;
+}
+
+Hash EntityFrameCache::Model(Entity entity) {
+    Entry& entry = Lookup(entity);
+    if (!(entry.known & HasModel)) {
+        entry.model = TV_NATIVE(ENTITY::GET_ENTITY_MODEL(entity));
+        entry.known |= HasModel;
+    }
+    return entry.model;
+}
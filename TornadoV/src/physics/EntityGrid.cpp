@@ -0,0 +1,104 @@
+#include "EntityGrid.h"
+#include "MathEx.h"
+#include <algorithm>
+#include <cmath>
+
+EntityGrid::EntityGrid()
+    : m_bucketStart(BucketCount + 1, 0), m_bucketStamp(BucketCount, 0), m_queryStamp(0) {
+}
+
+int EntityGrid::CellCoord(float value) {
+    return (int)std::floor(value / CellSize);
+}
+
+int EntityGrid::BucketOf(int cellX, int cellY) {
+    unsigned int h = ((unsigned int)cellX * 73856093u) ^ ((unsigned int)cellY * 19349663u);
+    return (int)(h & (BucketCount - 1));
+}
+
+void EntityGrid::Clear() {
+    m_entities.clear();
+    m_bucketOf.clear();
+    m_sorted.clear();
+    m_owner.clear();
+    m_ownerDist.clear();
+    std::fill(m_bucketStart.begin(), m_bucketStart.end(), 0);
+}
+
+void EntityGrid::Insert(Entity handle, const Vector3& position, EntityKind kind) {
+    m_entities.push_back({ handle, position, kind });
+    m_bucketOf.push_back(BucketOf(CellCoord(position.x), CellCoord(position.y)));
+    m_owner.push_back(-1);
+    m_ownerDist.push_back(0.0f);
+}
+
+void EntityGrid::Build() {
+    // Counting sort by bucket: bucketStart[b]..bucketStart[b + 1] indexes into m_sorted
+    std::fill(m_bucketStart.begin(), m_bucketStart.end(), 0);
+    for (int bucket : m_bucketOf) {
+        m_bucketStart[bucket + 1]++;
+    }
+    for (int b = 0; b < BucketCount; b++) {
+        m_bucketStart[b + 1] += m_bucketStart[b];
+    }
+
+    m_sorted.resize(m_entities.size());
+    std::vector<int> cursor(m_bucketStart.begin(), m_bucketStart.end() - 1);
+    for (int i = 0; i < (int)m_entities.size(); i++) {
+        m_sorted[cursor[m_bucketOf[i]]++] = i;
+    }
+}
+
+void EntityGrid::Query(const Vector3& center, float radius, std::vector<int>& outIndices) const {
+    size_t first = outIndices.size();
+
+    int minX = CellCoord(center.x - radius);
+    int maxX = CellCoord(center.x + radius);
+    int minY = CellCoord(center.y - radius);
+    int maxY = CellCoord(center.y + radius);
+
+    // A disc wider than the table would wrap onto every bucket anyway, scan linearly
+    long long cellCount = (long long)(maxX - minX + 1) * (maxY - minY + 1);
+    if (cellCount >= BucketCount) {
+        for (int i = 0; i < (int)m_entities.size(); i++) {
+            if (MathEx::Distance2D(m_entities[i].position, center) <= radius)
+                outIndices.push_back(i);
+        }
+        return;
+    }
+
+    // Different cells can hash to the same bucket, visit each bucket only once
+    if (++m_queryStamp == 0) {
+        std::fill(m_bucketStamp.begin(), m_bucketStamp.end(), 0u);
+        m_queryStamp = 1;
+    }
+    for (int cx = minX; cx <= maxX; cx++) {
+        for (int cy = minY; cy <= maxY; cy++) {
+            int bucket = BucketOf(cx, cy);
+            if (m_bucketStamp[bucket] == m_queryStamp)
+                continue;
+            m_bucketStamp[bucket] = m_queryStamp;
+
+            for (int s = m_bucketStart[bucket]; s < m_bucketStart[bucket + 1]; s++) {
+                int idx = m_sorted[s];
+                if (MathEx::Distance2D(m_entities[idx].position, center) <= radius)
+                    outIndices.push_back(idx);
+            }
+        }
+    }
+
+    std::sort(outIndices.begin() + first, outIndices.end());
+}
+
+void EntityGrid::ClaimOwners(int owner, const Vector3& center, float radius) {
+    m_claimCandidates.clear();
+    Query(center, radius, m_claimCandidates);
+
+    for (int idx : m_claimCandidates) {
+        float dist = MathEx::Distance2D(m_entities[idx].position, center);
+        if (m_owner[idx] == -1 || dist < m_ownerDist[idx]) {
+            m_owner[idx] = owner;
+            m_ownerDist[idx] = dist;
+        }
+    }
+}
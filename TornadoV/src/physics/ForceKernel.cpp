@@ -0,0 +1,148 @@
+#include "ForceKernel.h"
+#include "MathEx.h"
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define TORNADOV_FORCE_SSE 1
+#endif
+
+void ForceBatch::Clear() {
+    handles.clear();
+    isPlayer.clear();
+    posX.clear();
+    posY.clear();
+    posZ.clear();
+    xBias.clear();
+    yBias.clear();
+    dist.clear();
+    classification.clear();
+}
+
+void ForceBatch::Push(Entity handle, const Vector3& position, float biasX, float biasY, bool player, float distance, unsigned char cls) {
+    handles.push_back(handle);
+    isPlayer.push_back(player ? 1 : 0);
+    posX.push_back(position.x);
+    posY.push_back(position.y);
+    posZ.push_back(position.z);
+    xBias.push_back(biasX);
+    yBias.push_back(biasY);
+    dist.push_back(distance);
+    classification.push_back(cls);
+}
+
+void ForceKernel::ResizeOutputs(ForceBatch& batch) {
+    size_t n = batch.handles.size();
+    batch.valid.resize(n);
+    batch.dirX.resize(n);
+    batch.dirY.resize(n);
+    batch.dirZ.resize(n);
+    batch.upX.resize(n);
+    batch.upY.resize(n);
+    batch.upZ.resize(n);
+    batch.tanX.resize(n);
+    batch.tanY.resize(n);
+    batch.tanZ.resize(n);
+}
+
+void ForceKernel::ComputeScalar(ForceBatch& batch, const Vector3& core, int begin) {
+    ResizeOutputs(batch);
+
+    for (int i = begin; i < batch.Size(); i++) {
+        Vector3 pos = { batch.posX[i], 0, batch.posY[i], 0, batch.posZ[i], 0 };
+
+        Vector3 targetPos = { core.x + batch.xBias[i], 0, core.y + batch.yBias[i], 0, pos.z, 0 };
+        Vector3 dirVec = MathEx::Subtract(targetPos, pos);
+        batch.valid[i] = MathEx::Length(dirVec) < 0.0001f ? 0 : 1;
+
+        Vector3 direction = MathEx::Normalize(dirVec);
+        batch.dirX[i] = direction.x;
+        batch.dirY[i] = direction.y;
+        batch.dirZ[i] = direction.z;
+
+        // MATCH C# upDir = Vector3.Normalize(new Vector3(_position.X, _position.Y, _position.Z + 1000.0f) - entity.Position);
+        Vector3 upTarget = { core.x, 0, core.y, 0, core.z + 1000.0f, 0 };
+        Vector3 upDir = MathEx::Normalize(MathEx::Subtract(upTarget, pos));
+        batch.upX[i] = upDir.x;
+        batch.upY[i] = upDir.y;
+        batch.upZ[i] = upDir.z;
+
+        Vector3 worldUp = { 0.0f, 0, 0.0f, 0, 1.0f, 0 };
+        Vector3 normCross = MathEx::Normalize(MathEx::Cross(direction, worldUp));
+        batch.tanX[i] = normCross.x;
+        batch.tanY[i] = normCross.y;
+        batch.tanZ[i] = normCross.z;
+    }
+}
+
+#ifdef TORNADOV_FORCE_SSE
+// MathEx::Normalize semantics: zero vector stays zero, otherwise divide by the length.
+// Length is summed as (x*x + y*y) + z*z to stay bit-identical with MathEx::Length.
+static inline void NormalizeSSE(__m128& x, __m128& y, __m128& z, __m128* lengthOut = nullptr) {
+    __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+    __m128 isZero = _mm_cmpeq_ps(len, _mm_setzero_ps());
+    x = _mm_andnot_ps(isZero, _mm_div_ps(x, len));
+    y = _mm_andnot_ps(isZero, _mm_div_ps(y, len));
+    z = _mm_andnot_ps(isZero, _mm_div_ps(z, len));
+    if (lengthOut) *lengthOut = len;
+}
+#endif
+
+void ForceKernel::Compute(ForceBatch& batch, const Vector3& core) {
+#ifdef TORNADOV_FORCE_SSE
+    ResizeOutputs(batch);
+
+    const int n = batch.Size();
+    const __m128 coreX = _mm_set1_ps(core.x);
+    const __m128 coreY = _mm_set1_ps(core.y);
+    const __m128 upTargetZ = _mm_set1_ps(core.z + 1000.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minLength = _mm_set1_ps(0.0001f);
+
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 px = _mm_loadu_ps(&batch.posX[i]);
+        __m128 py = _mm_loadu_ps(&batch.posY[i]);
+        __m128 pz = _mm_loadu_ps(&batch.posZ[i]);
+
+        // Pull direction toward the biased core, on the entity's own height
+        __m128 dx = _mm_sub_ps(_mm_add_ps(coreX, _mm_loadu_ps(&batch.xBias[i])), px);
+        __m128 dy = _mm_sub_ps(_mm_add_ps(coreY, _mm_loadu_ps(&batch.yBias[i])), py);
+        __m128 dz = _mm_sub_ps(pz, pz);
+        __m128 dirLength;
+        NormalizeSSE(dx, dy, dz, &dirLength);
+
+        int validMask = _mm_movemask_ps(_mm_cmpnlt_ps(dirLength, minLength));
+        batch.valid[i + 0] = (validMask >> 0) & 1;
+        batch.valid[i + 1] = (validMask >> 1) & 1;
+        batch.valid[i + 2] = (validMask >> 2) & 1;
+        batch.valid[i + 3] = (validMask >> 3) & 1;
+
+        _mm_storeu_ps(&batch.dirX[i], dx);
+        _mm_storeu_ps(&batch.dirY[i], dy);
+        _mm_storeu_ps(&batch.dirZ[i], dz);
+
+        // Lift toward a point 1000 units above the core
+        __m128 ux = _mm_sub_ps(coreX, px);
+        __m128 uy = _mm_sub_ps(coreY, py);
+        __m128 uz = _mm_sub_ps(upTargetZ, pz);
+        NormalizeSSE(ux, uy, uz);
+        _mm_storeu_ps(&batch.upX[i], ux);
+        _mm_storeu_ps(&batch.upY[i], uy);
+        _mm_storeu_ps(&batch.upZ[i], uz);
+
+        // cross(dir, (0, 0, 1)) spelled out like MathEx::Cross so zero signs match
+        __m128 tx = _mm_sub_ps(_mm_mul_ps(dy, one), _mm_mul_ps(dz, zero));
+        __m128 ty = _mm_sub_ps(_mm_mul_ps(dz, zero), _mm_mul_ps(dx, one));
+        __m128 tz = _mm_sub_ps(_mm_mul_ps(dx, zero), _mm_mul_ps(dy, zero));
+        NormalizeSSE(tx, ty, tz);
+        _mm_storeu_ps(&batch.tanX[i], tx);
+        _mm_storeu_ps(&batch.tanY[i], ty);
+        _mm_storeu_ps(&batch.tanZ[i], tz);
+    }
+
+    ComputeScalar(batch, core, i);
+#else
+    ComputeScalar(batch, core);
+#endif
+}
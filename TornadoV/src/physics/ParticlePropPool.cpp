@@ -0,0 +1,93 @@
+#include "ParticlePropPool.h"
+#include "natives.h"
+#include "Logger.h"
+#include "AssetCache.h"
+
+ParticlePropPool::ParticlePropPool()
+    : m_highWaterMark(512) {
+}
+
+ParticlePropPool::~ParticlePropPool() {
+    Clear();
+}
+
+Entity ParticlePropPool::Acquire(const Vector3& position) {
+    while (!m_parked.empty()) {
+        Entity prop = m_parked.back();
+        m_parked.pop_back();
+
+        // The game can still clean parked props up on a session change
+        if (!ENTITY::DOES_ENTITY_EXIST(prop)) continue;
+
+        ENTITY::FREEZE_ENTITY_POSITION(prop, false);
+        ENTITY::SET_ENTITY_COORDS(prop, position.x, position.y, position.z, false, false, false, false);
+        return prop;
+    }
+
+    return CreateProp(position);
+}
+
+void ParticlePropPool::Release(Entity prop) {
+    if (!ENTITY::DOES_ENTITY_EXIST(prop)) return;
+
+    if ((int)m_parked.size() >= m_highWaterMark) {
+        ENTITY::DELETE_ENTITY(&prop);
+        return;
+    }
+
+    Vector3 position = ENTITY::GET_ENTITY_COORDS(prop, false);
+    ENTITY::SET_ENTITY_COORDS(prop, position.x, position.y, PARK_DEPTH, false, false, false, false);
+    ENTITY::FREEZE_ENTITY_POSITION(prop, true);
+    m_parked.push_back(prop);
+}
+
+void ParticlePropPool::SetHighWaterMark(int maxParked) {
+    m_highWaterMark = maxParked < 0 ? 0 : maxParked;
+    Trim();
+}
+
+void ParticlePropPool::Clear() {
+    for (Entity prop : m_parked) {
+        if (ENTITY::DOES_ENTITY_EXIST(prop)) {
+            ENTITY::DELETE_ENTITY(&prop);
+        }
+    }
+    m_parked.clear();
+}
+
+void ParticlePropPool::Trim() {
+    while ((int)m_parked.size() > m_highWaterMark) {
+        Entity prop = m_parked.back();
+        m_parked.pop_back();
+        if (ENTITY::DOES_ENTITY_EXIST(prop)) {
+            ENTITY::DELETE_ENTITY(&prop);
+        }
+    }
+}
+
+Entity ParticlePropPool::CreateProp(const Vector3& position) {
+    // The building vortex holds the model through AssetCache
+    if (!AssetCache::Get().IsLoaded(AssetKind::Model, PROP_MODEL)) {
+        Logger::Error("ParticlePropPool: Prop model is not loaded!");
+        return 0;
+    }
+    Hash model = AssetCache::HashName(PROP_MODEL);
+    
+    Entity prop = OBJECT::CREATE_OBJECT(model, position.x, position.y, position.z, false, false, false);
+    if (!ENTITY::DOES_ENTITY_EXIST(prop)) {
+        Logger::Error("ParticlePropPool: Failed to create object!");
+        return 0;
+    }
+
+    ENTITY::SET_ENTITY_COLLISION(prop, false, false);
+    ENTITY::SET_ENTITY_VISIBLE(prop, false, false);
+    ENTITY::FREEZE_ENTITY_POSITION(prop, false); 
+    ENTITY::_0x3910051CCECDB00C(prop, false);
+    
+    // CRITICAL FIX: Prevent entity distance culling
+    // This keeps particles active even when far from player or behind objects
+    ENTITY::SET_ENTITY_AS_MISSION_ENTITY(prop, true, true);
+    ENTITY::SET_ENTITY_ALPHA(prop, 0, false);
+    
+    return prop;
+}
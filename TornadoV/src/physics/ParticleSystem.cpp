@@ -0,0 +1,176 @@
+#include "ParticleSystem.h"
+#include <algorithm>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define TORNADOV_PARTICLE_SSE 1
+#endif
+
+static const float TwoPi = 6.28318f; // Same wrap constant TornadoParticle used
+static const float Pi = 3.14159265f;
+static const float HalfPi = 1.57079633f;
+
+// sin on [-pi, pi]: fold onto [0, pi/2] and use an odd Taylor polynomial to x^11.
+// Max error is around 6e-8 rad, well below what a particle position can show.
+static inline float SinPoly(float x) {
+    float sign = x < 0.0f ? -1.0f : 1.0f;
+    float ax = x * sign;
+    float r = (std::min)(ax, Pi - ax);
+    float r2 = r * r;
+    float p = -2.50521084e-8f;
+    p = p * r2 + 2.75573192e-6f;
+    p = p * r2 - 1.98412698e-4f;
+    p = p * r2 + 8.33333333e-3f;
+    p = p * r2 - 1.66666667e-1f;
+    return sign * (r + r * r2 * p);
+}
+
+static inline float WrapPi(float x) {
+    if (x > Pi) return x - 2.0f * Pi;
+    if (x < -Pi) return x + 2.0f * Pi;
+    return x;
+}
+
+int ParticleSystem::Add(Entity prop, int layer, const Quaternion& rotation, float radius, float offsetZ, float angularRate) {
+    int index = Size();
+
+    m_props.push_back(prop);
+    m_alive.push_back(prop != 0 ? 1 : 0);
+    m_layer.push_back(layer);
+    m_angle.push_back(0.0f);
+    m_radius.push_back(radius);
+    m_rate.push_back(angularRate);
+    m_offsetZ.push_back(offsetZ);
+
+    // Same columns MathEx::MultiplyVector builds from the quaternion
+    Vector3 column0 = MathEx::MultiplyVector({ 1.0f, 0, 0.0f, 0, 0.0f, 0 }, rotation);
+    Vector3 column1 = MathEx::MultiplyVector({ 0.0f, 0, 1.0f, 0, 0.0f, 0 }, rotation);
+    m_r00.push_back(column0.x);
+    m_r10.push_back(column0.y);
+    m_r20.push_back(column0.z);
+    m_r01.push_back(column1.x);
+    m_r11.push_back(column1.y);
+    m_r21.push_back(column1.z);
+
+    m_outX.push_back(0.0f);
+    m_outY.push_back(0.0f);
+    m_outZ.push_back(0.0f);
+    return index;
+}
+
+void ParticleSystem::Clear() {
+    m_props.clear();
+    m_alive.clear();
+    m_layer.clear();
+    m_angle.clear();
+    m_radius.clear();
+    m_rate.clear();
+    m_offsetZ.clear();
+    m_r00.clear();
+    m_r10.clear();
+    m_r20.clear();
+    m_r01.clear();
+    m_r11.clear();
+    m_r21.clear();
+    m_outX.clear();
+    m_outY.clear();
+    m_outZ.clear();
+    m_checkCursor = 0;
+}
+
+void ParticleSystem::AdvanceScalar(ParticleSystem& system, const Vector3& center, float angleStep, int begin) {
+    for (int i = begin; i < system.Size(); i++) {
+        float angle = system.m_angle[i];
+        if (angle > TwoPi)
+            angle -= TwoPi;
+        else if (angle < -TwoPi)
+            angle += TwoPi;
+
+        float reduced = WrapPi(angle);
+        float sinAngle = SinPoly(reduced);
+        float cosAngle = SinPoly(WrapPi(reduced + HalfPi));
+
+        float localX = system.m_radius[i] * cosAngle;
+        float localY = system.m_radius[i] * sinAngle;
+
+        system.m_outX[i] = center.x + system.m_r00[i] * localX + system.m_r01[i] * localY;
+        system.m_outY[i] = center.y + system.m_r10[i] * localX + system.m_r11[i] * localY;
+        system.m_outZ[i] = center.z + system.m_offsetZ[i] + system.m_r20[i] * localX + system.m_r21[i] * localY;
+
+        system.m_angle[i] = angle - angleStep * system.m_rate[i];
+    }
+}
+
+#ifdef TORNADOV_PARTICLE_SSE
+static inline __m128 WrapPiSSE(__m128 x) {
+    const __m128 pi = _mm_set1_ps(Pi);
+    const __m128 twoPi = _mm_set1_ps(2.0f * Pi);
+    x = _mm_sub_ps(x, _mm_and_ps(_mm_cmpgt_ps(x, pi), twoPi));
+    x = _mm_add_ps(x, _mm_and_ps(_mm_cmplt_ps(x, _mm_sub_ps(_mm_setzero_ps(), pi)), twoPi));
+    return x;
+}
+
+// Four-lane SinPoly, same folding and coefficients
+static inline __m128 SinPolySSE(__m128 x) {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 sign = _mm_and_ps(x, signMask);
+    __m128 ax = _mm_andnot_ps(signMask, x);
+    __m128 r = _mm_min_ps(ax, _mm_sub_ps(_mm_set1_ps(Pi), ax));
+    __m128 r2 = _mm_mul_ps(r, r);
+    __m128 p = _mm_set1_ps(-2.50521084e-8f);
+    p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(2.75573192e-6f));
+    p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(-1.98412698e-4f));
+    p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(8.33333333e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(-1.66666667e-1f));
+    __m128 result = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), p));
+    return _mm_xor_ps(result, sign);
+}
+#endif
+
+void ParticleSystem::Advance(const Vector3& center, float angleStep) {
+#ifdef TORNADOV_PARTICLE_SSE
+    const int n = Size();
+    const __m128 cx = _mm_set1_ps(center.x);
+    const __m128 cy = _mm_set1_ps(center.y);
+    const __m128 cz = _mm_set1_ps(center.z);
+    const __m128 step = _mm_set1_ps(angleStep);
+    const __m128 twoPi = _mm_set1_ps(TwoPi);
+    const __m128 negTwoPi = _mm_set1_ps(-TwoPi);
+    const __m128 halfPi = _mm_set1_ps(HalfPi);
+
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        // Single wrap step, exactly like the scalar path
+        __m128 angle = _mm_loadu_ps(&m_angle[i]);
+        __m128 over = _mm_cmpgt_ps(angle, twoPi);
+        __m128 under = _mm_cmplt_ps(angle, negTwoPi);
+        angle = _mm_sub_ps(angle, _mm_and_ps(over, twoPi));
+        angle = _mm_add_ps(angle, _mm_and_ps(under, twoPi));
+
+        __m128 reduced = WrapPiSSE(angle);
+        __m128 sinAngle = SinPolySSE(reduced);
+        __m128 cosAngle = SinPolySSE(WrapPiSSE(_mm_add_ps(reduced, halfPi)));
+
+        __m128 radius = _mm_loadu_ps(&m_radius[i]);
+        __m128 localX = _mm_mul_ps(radius, cosAngle);
+        __m128 localY = _mm_mul_ps(radius, sinAngle);
+
+        __m128 x = _mm_add_ps(_mm_add_ps(cx, _mm_mul_ps(_mm_loadu_ps(&m_r00[i]), localX)), _mm_mul_ps(_mm_loadu_ps(&m_r01[i]), localY));
+        __m128 y = _mm_add_ps(_mm_add_ps(cy, _mm_mul_ps(_mm_loadu_ps(&m_r10[i]), localX)), _mm_mul_ps(_mm_loadu_ps(&m_r11[i]), localY));
+        __m128 z = _mm_add_ps(_mm_add_ps(_mm_add_ps(cz, _mm_loadu_ps(&m_offsetZ[i])), _mm_mul_ps(_mm_loadu_ps(&m_r20[i]), localX)), _mm_mul_ps(_mm_loadu_ps(&m_r21[i]), localY));
+        _mm_storeu_ps(&m_outX[i], x);
+        _mm_storeu_ps(&m_outY[i], y);
+        _mm_storeu_ps(&m_outZ[i], z);
+
+        _mm_storeu_ps(&m_angle[i], _mm_sub_ps(angle, _mm_mul_ps(step, _mm_loadu_ps(&m_rate[i]))));
+    }
+
+    AdvanceScalar(*this, center, angleStep, i);
+#else
+    AdvanceScalar(*this, center, angleStep, 0);
+#endif
+}
+
+Vector3 ParticleSystem::GetPosition(int index) const {
+    return { m_outX[index], 0, m_outY[index], 0, m_outZ[index], 0 };
+}
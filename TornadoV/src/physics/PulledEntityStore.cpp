@@ -0,0 +1,163 @@
+#include "PulledEntityStore.h"
+#include <algorithm>
+
+PulledEntityStore::PulledEntityStore()
+    : m_mask(0), m_shift(32) {
+    Rehash(256);
+}
+
+int PulledEntityStore::HomeSlot(Entity handle) const {
+    // Fibonacci hashing: handles are small pool indices with a generation byte,
+    // and the top bits of the product are the well-mixed ones
+    return (int)(((unsigned int)handle * 2654435769u) >> m_shift);
+}
+
+int PulledEntityStore::SlotOf(Entity handle) const {
+    int slot = HomeSlot(handle);
+    while (m_table[slot] != EmptySlot) {
+        if (m_handles[m_table[slot]] == handle)
+            return slot;
+        slot = (slot + 1) & m_mask;
+    }
+    return -1;
+}
+
+int PulledEntityStore::Find(Entity handle) const {
+    int slot = SlotOf(handle);
+    return slot == -1 ? -1 : m_table[slot];
+}
+
+int PulledEntityStore::Add(Entity handle, float xBias, float yBias, bool isPlayer, unsigned char classification) {
+    int existing = Find(handle);
+    if (existing != -1) {
+        m_xBias[existing] = xBias;
+        m_yBias[existing] = yBias;
+        m_isPlayer[existing] = isPlayer ? 1 : 0;
+        m_class[existing] = classification;
+        return existing;
+    }
+
+    // Keep the load factor at or below one half
+    if ((Size() + 1) * 2 > (int)m_table.size()) {
+        Rehash((int)m_table.size() * 2);
+    }
+
+    int index = Size();
+    m_handles.push_back(handle);
+    m_xBias.push_back(xBias);
+    m_yBias.push_back(yBias);
+    m_isPlayer.push_back(isPlayer ? 1 : 0);
+    m_class.push_back(classification);
+    m_starved.push_back(0);
+    m_posX.push_back(0.0f);
+    m_posY.push_back(0.0f);
+    m_posZ.push_back(0.0f);
+
+    int slot = HomeSlot(handle);
+    while (m_table[slot] != EmptySlot) {
+        slot = (slot + 1) & m_mask;
+    }
+    m_table[slot] = index;
+    return index;
+}
+
+void PulledEntityStore::EraseSlot(int slot) {
+    // Backward-shift deletion keeps probe chains intact without tombstones
+    int hole = slot;
+    int next = slot;
+    while (true) {
+        next = (next + 1) & m_mask;
+        if (m_table[next] == EmptySlot)
+            break;
+
+        int home = HomeSlot(m_handles[m_table[next]]);
+        bool canMove = (next > hole) ? (home <= hole || home > next)
+                                     : (home <= hole && home > next);
+        if (canMove) {
+            m_table[hole] = m_table[next];
+            hole = next;
+        }
+    }
+    m_table[hole] = EmptySlot;
+}
+
+void PulledEntityStore::RemoveAt(int index) {
+    int last = Size() - 1;
+
+    EraseSlot(SlotOf(m_handles[index]));
+
+    if (index != last) {
+        m_table[SlotOf(m_handles[last])] = index;
+
+        m_handles[index] = m_handles[last];
+        m_xBias[index] = m_xBias[last];
+        m_yBias[index] = m_yBias[last];
+        m_isPlayer[index] = m_isPlayer[last];
+        m_class[index] = m_class[last];
+        m_starved[index] = m_starved[last];
+        m_posX[index] = m_posX[last];
+        m_posY[index] = m_posY[last];
+        m_posZ[index] = m_posZ[last];
+    }
+
+    m_handles.pop_back();
+    m_xBias.pop_back();
+    m_yBias.pop_back();
+    m_isPlayer.pop_back();
+    m_class.pop_back();
+    m_starved.pop_back();
+    m_posX.pop_back();
+    m_posY.pop_back();
+    m_posZ.pop_back();
+}
+
+bool PulledEntityStore::Remove(Entity handle) {
+    int index = Find(handle);
+    if (index == -1) return false;
+    RemoveAt(index);
+    return true;
+}
+
+void PulledEntityStore::Clear() {
+    m_handles.clear();
+    m_xBias.clear();
+    m_yBias.clear();
+    m_isPlayer.clear();
+    m_class.clear();
+    m_starved.clear();
+    m_posX.clear();
+    m_posY.clear();
+    m_posZ.clear();
+    std::fill(m_table.begin(), m_table.end(), EmptySlot);
+}
+
+void PulledEntityStore::AgeAll() {
+    for (int& starved : m_starved) {
+        starved++;
+    }
+}
+
+Vector3 PulledEntityStore::GetPosition(int index) const {
+    return { m_posX[index], 0, m_posY[index], 0, m_posZ[index], 0 };
+}
+
+void PulledEntityStore::SetPosition(int index, const Vector3& position) {
+    m_posX[index] = position.x;
+    m_posY[index] = position.y;
+    m_posZ[index] = position.z;
+}
+
+void PulledEntityStore::Rehash(int capacity) {
+    m_table.assign(capacity, EmptySlot);
+    m_mask = capacity - 1;
+    m_shift = 32;
+    for (int size = capacity; size > 1; size >>= 1) m_shift--;
+
+    for (int i = 0; i < Size(); i++) {
+        int slot = HomeSlot(m_handles[i]);
+        while (m_table[slot] != EmptySlot) {
+            slot = (slot + 1) & m_mask;
+        }
+        m_table[slot] = i;
+    }
+}
@@ -0,0 +1,115 @@
+#include "ShapeTestQueue.h"
+#include "Profiler.h"
+#include "NativeStats.h"
+#include "natives.h"
+
+// _GET_RAYCAST_RESULT return values
+static const int SHAPE_TEST_FAILED = 0;
+static const int SHAPE_TEST_PENDING = 1;
+
+void ShapeTestQueue::Update(int gameTime) {
+    TV_PROFILE_ZONE("ShapeTestQueue::Update");
+    TV_NATIVE_SCOPE("ShapeTestQueue::Update", -1);
+
+    // Orphans only need collecting so the game can reuse their slots
+    for (size_t i = 0; i < m_orphans.size();) {
+        BOOL hit = FALSE;
+        Vector3 endCoords, surfaceNormal;
+        Entity entityHit = 0;
+        int status = TV_NATIVE(WORLDPROBE::_GET_RAYCAST_RESULT(m_orphans[i], &hit, &endCoords, &surfaceNormal, &entityHit));
+        if (status == SHAPE_TEST_PENDING) {
+            i++;
+            continue;
+        }
+
+        m_orphans[i] = m_orphans.back();
+        m_orphans.pop_back();
+    }
+
+    // Harvest: anything still pending stays in flight for another frame
+    for (size_t i = 0; i < m_inFlight.size();) {
+        Probe& probe = m_probes[m_inFlight[i]];
+
+        BOOL hit = FALSE;
+        Vector3 endCoords, surfaceNormal;
+        Entity entityHit = 0;
+        int status = TV_NATIVE(WORLDPROBE::_GET_RAYCAST_RESULT(probe.handle, &hit, &endCoords, &surfaceNormal, &entityHit));
+        if (status == SHAPE_TEST_PENDING) {
+            i++;
+            continue;
+        }
+
+        // A failed probe keeps the previous answer and is retried on the next request
+        if (status != SHAPE_TEST_FAILED) {
+            probe.hasResult = true;
+            probe.hit = hit != FALSE;
+            probe.resultTime = gameTime;
+        }
+        probe.state = ProbeState::Idle;
+
+        m_inFlight[i] = m_inFlight.back();
+        m_inFlight.pop_back();
+    }
+
+    // Submit within the per-frame budget, oldest request first
+    int started = 0;
+    while (!m_queue.empty() && started < PROBES_PER_FRAME && GetInFlightCount() < MAX_IN_FLIGHT) {
+        Entity entity = m_queue.front();
+        m_queue.pop_front();
+
+        auto it = m_probes.find(entity);
+        if (it == m_probes.end() || it->second.state != ProbeState::Queued) continue;
+
+        Probe& probe = it->second;
+        probe.handle = TV_NATIVE(WORLDPROBE::_START_SHAPE_TEST_RAY(probe.from.x, probe.from.y, probe.from.z,
+            probe.to.x, probe.to.y, probe.to.z, 1, entity, 7));
+        probe.state = ProbeState::InFlight;
+        m_inFlight.push_back(entity);
+        started++;
+    }
+
+    if (gameTime - m_lastSweep > FORGET_AFTER_MS) {
+        Sweep(gameTime);
+    }
+}
+
+void ShapeTestQueue::Request(Entity entity, const Vector3& from, const Vector3& to, int gameTime) {
+    Probe& probe = m_probes[entity];
+    probe.lastRequest = gameTime;
+
+    if (probe.state != ProbeState::Idle) return;
+    if (probe.hasResult && gameTime - probe.resultTime < RESULT_TTL_MS) return;
+
+    probe.from = from;
+    probe.to = to;
+    probe.state = ProbeState::Queued;
+    m_queue.push_back(entity);
+}
+
+bool ShapeTestQueue::IsSheltered(Entity entity) const {
+    auto it = m_probes.find(entity);
+    return it != m_probes.end() && it->second.hasResult && it->second.hit;
+}
+
+void ShapeTestQueue::Sweep(int gameTime) {
+    m_lastSweep = gameTime;
+    for (auto it = m_probes.begin(); it != m_probes.end();) {
+        // In-flight probes are kept until harvested so their handles are never lost
+        if (it->second.state != ProbeState::InFlight && gameTime - it->second.lastRequest > FORGET_AFTER_MS) {
+            it = m_probes.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void ShapeTestQueue::Clear() {
+    for (Entity entity : m_inFlight) {
+        m_orphans.push_back(m_probes[entity].handle);
+    }
+
+    m_probes.clear();
+    m_queue.clear();
+    m_inFlight.clear();
+    m_lastSweep = 0;
+}
@@ -0,0 +1,84 @@
+#include "TeardownQueue.h"
+#include "TornadoParticle.h"
+#include "Profiler.h"
+#include "NativeStats.h"
+#include <algorithm>
+
+TeardownQueue::TeardownQueue() {
+}
+
+TeardownQueue::~TeardownQueue() {
+    Flush();
+}
+
+void TeardownQueue::Push(std::vector<std::unique_ptr<TornadoParticle>> particles, std::vector<AssetCache::Key> assets) {
+    if (particles.empty()) {
+        Retiring entry;
+        entry.assets = std::move(assets);
+        m_queue.push_back(std::move(entry));
+        return;
+    }
+
+    for (auto& particle : particles) {
+        Retiring entry;
+        entry.particle = std::move(particle);
+        m_queue.push_back(std::move(entry));
+    }
+    m_queue.back().assets = std::move(assets);
+}
+
+void TeardownQueue::Update(int gameTime, const FrameBudget& budget) {
+    if (m_queue.empty()) return;
+
+    TV_PROFILE_ZONE("TeardownQueue::Update");
+    TV_NATIVE_SCOPE("TeardownQueue::Update", -1);
+
+    // Dispose from the front once the fade has run its course
+    int retired = 0;
+    while (!m_queue.empty() && retired < RETIRES_PER_FRAME) {
+        if (retired >= MIN_RETIRES_PER_FRAME && budget.Expired()) break;
+
+        Retiring& entry = m_queue.front();
+        if (entry.particle && FADE_MS > 0) {
+            if (entry.fadeStart < 0 || gameTime - entry.fadeStart < FADE_MS) break;
+        }
+
+        Retire(entry);
+        m_queue.pop_front();
+        retired++;
+    }
+
+    if (FADE_MS <= 0) return;
+
+    // The fade window slides down the funnel as the front is disposed
+    int window = (std::min)((int)m_queue.size(), FADE_WINDOW);
+    for (int i = 0; i < window; i++) {
+        Retiring& entry = m_queue[i];
+        if (!entry.particle) continue;
+
+        if (entry.fadeStart < 0) {
+            entry.fadeStart = gameTime;
+        }
+
+        int step = (gameTime - entry.fadeStart) * FADE_STEPS / FADE_MS;
+        float alpha = 1.0f - (float)(std::min)(step, FADE_STEPS) / FADE_STEPS;
+        entry.particle->FadeTo(alpha);
+    }
+}
+
+void TeardownQueue::Flush() {
+    while (!m_queue.empty()) {
+        Retire(m_queue.front());
+        m_queue.pop_front();
+    }
+}
+
+void TeardownQueue::Retire(Retiring& entry) {
+    // ~TornadoParticle -> Dispose(): stops the FX and hands the prop back to the pool
+    entry.particle.reset();
+
+    for (AssetCache::Key asset : entry.assets) {
+        AssetCache::Get().Release(asset);
+    }
+    entry.assets.clear();
+}
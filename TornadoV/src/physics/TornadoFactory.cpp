@@ -1,15 +1,17 @@
 #include "TornadoFactory.h"
-#include "TornadoMenu.h"
 #include "natives.h"
 #include "MathEx.h"
 #include "IniHelper.h"
 #include "Logger.h"
 #include "AudioManager.h"
+#include "Profiler.h"
+#include "NativeStats.h"
 #include <algorithm>
 #include <cmath>
 
-TornadoFactory::TornadoFactory()
-    : m_spawnDelayAdditive(0), m_spawnDelayStartTime(0),
+TornadoFactory::TornadoFactory(const TornadoSettings& settings)
+    : m_budgetCursor(0), m_settings(settings),
+      m_spawnDelayAdditive(0), m_spawnDelayStartTime(0),
       m_lastSpawnAttempt(0), m_lastSpawnCompleteTime(0),
       m_spawnInProgress(false), m_isScheduledSpawn(false), m_delaySpawn(false),
       m_easHandle(0), m_sirenHandle(0) {
@@ -20,7 +22,7 @@ TornadoFactory::~TornadoFactory() {
 }
 
 TornadoVortex* TornadoFactory::CreateVortex(Vector3 position) {
-    int gameTime = GAMEPLAY::GET_GAME_TIMER();
+    int gameTime = m_frame.gameTime;
     Logger::Log("Factory: CreateVortex at (" + std::to_string(position.x) + ", " + std::to_string(position.y) + ", " + std::to_string(position.z) + ")");
     
     // OPTIMIZATION: Enforce cooldown between spawns
@@ -38,7 +40,7 @@ TornadoVortex* TornadoFactory::CreateVortex(Vector3 position) {
 
     // Maintain limit by removing oldest if necessary
     if (m_activeVortexList.size() >= VortexLimit) {
-        m_activeVortexList.front()->Dispose();
+        m_activeVortexList.front()->Retire(m_teardown);
         m_activeVortexList.erase(m_activeVortexList.begin());
     }
 
@@ -51,57 +53,63 @@ TornadoVortex* TornadoFactory::CreateVortex(Vector3 position) {
 
     position.z = groundZ - 10.0f;
 
-    auto tVortex = std::make_unique<TornadoVortex>(position, false);
+    auto tVortex = std::make_unique<TornadoVortex>(position, false, &m_propPool, &m_entityClaims, &m_shapeTests, m_settings, m_frame);
 
-    try {
-        // OPTIMIZATION: Clear old particles before building new ones
-        GRAPHICS::REMOVE_PARTICLE_FX_IN_RANGE(position.x, position.y, position.z, 200.0f);
-
-        // Wait one frame to let particles clear
-        WAIT(0);
-
-        Logger::Log("Factory: Calling Build()...");
-        tVortex->Build();
-        Logger::Log("Factory: Build() returned.");
-
-        // OPTIMIZATION: Wait another frame after building
-        WAIT(0);
-    }
-    catch (const std::exception& e) {
-        Logger::Error("Factory: Error during Build: " + std::string(e.what()));
-        m_spawnInProgress = false;
-        return nullptr;
+    // OPTIMIZATION: Clear old particles before building new ones, unless they belong to a neighbour
+    // or a retired funnel is still fading out (its handles would go stale under the teardown queue)
+    bool neighbourNearby = IsTearingDown();
+    for (auto& vortex : m_activeVortexList) {
+        if (MathEx::Distance2D(vortex->GetPosition(), position) < 200.0f) {
+            neighbourNearby = true;
+            break;
+        }
     }
-    catch (...) {
-        Logger::Error("Factory: Unknown error during Build");
-        m_spawnInProgress = false;
-        return nullptr;
+    if (!neighbourNearby) {
+        GRAPHICS::REMOVE_PARTICLE_FX_IN_RANGE(position.x, position.y, position.z, 200.0f);
     }
 
+    // Build() runs incrementally from OnUpdate; m_spawnInProgress stays set until it finishes
+    Logger::Log("Factory: Vortex queued for build.");
+
     TornadoVortex* ptr = tVortex.get();
     m_activeVortexList.push_back(std::move(tVortex));
 
     // Play Global Sounds (2D) if not already playing
-    if (TornadoMenu::m_enableSirens || (TornadoMenu::m_enableEAS && m_easHandle == 0)) {
-        if (TornadoMenu::m_enableEAS && m_easHandle == 0) {
-            m_easHandle = AudioManager::Get().Play2D("eas_beeps", TornadoMenu::m_easVolume, false);
+    if (m_settings.enableSirens || (m_settings.enableEAS && m_easHandle == 0)) {
+        if (m_settings.enableEAS && m_easHandle == 0) {
+            m_easHandle = AudioManager::Get().Play2D("eas_beeps", m_settings.easVolume, false);
         }
-        if (TornadoMenu::m_enableSirens && m_sirenHandle == 0) {
-            m_sirenHandle = AudioManager::Get().Play2D("city_siren", TornadoMenu::m_sirenVolume, false);
+        if (m_settings.enableSirens && m_sirenHandle == 0) {
+            m_sirenHandle = AudioManager::Get().Play2D("city_siren", m_settings.sirenVolume, false);
         }
     }
 
-    if (ptr && TornadoMenu::m_notifications) {
+    if (ptr && m_settings.notifications) {
         IniHelper::ShowNotification("~g~Tornado spawned nearby.");
     }
 
-    m_lastSpawnCompleteTime = GAMEPLAY::GET_GAME_TIMER(); // OPTIMIZATION: Track completion time
-    m_spawnInProgress = false; // Reset flag
-
     return ptr;
 }
 
-void TornadoFactory::OnUpdate(int gameTime) {
+void TornadoFactory::OnUpdate(const FrameContext& frame, const TornadoSettings& settings, const FrameBudget& budget) {
+    TV_PROFILE_ZONE("Factory::OnUpdate");
+
+    m_frame = frame;
+    int gameTime = frame.gameTime;
+
+    if (settings.version != m_settings.version) {
+        m_settings = settings;
+    }
+
+    // Entity answers from last frame are stale now
+    m_entityCache.BeginFrame();
+
+    // Shelter probes requested last frame start now; earlier ones are collected,
+    // including any RemoveAll() left in flight
+    if (!m_activeVortexList.empty() || m_shapeTests.HasPending()) {
+        m_shapeTests.Update(gameTime);
+    }
+
     if (m_activeVortexList.empty()) {
         // Stop global sounds if they are playing
         if (m_easHandle != 0) {
@@ -113,8 +121,8 @@ void TornadoFactory::OnUpdate(int gameTime) {
             m_sirenHandle = 0;
         }
 
-        if (TornadoMenu::m_spawnInStorm) {
-                bool isStorming = GAMEPLAY::GET_RAIN_LEVEL() > 0.1f || 
+        if (m_settings.spawnInStorm) {
+                bool isStorming = frame.rainLevel > 0.1f || 
                                  GAMEPLAY::IS_PREV_WEATHER_TYPE(const_cast<char*>("CLEARING")) ||
                                  GAMEPLAY::IS_PREV_WEATHER_TYPE(const_cast<char*>("THUNDER")) ||
                                  GAMEPLAY::IS_PREV_WEATHER_TYPE(const_cast<char*>("RAIN")) ||
@@ -139,17 +147,17 @@ void TornadoFactory::OnUpdate(int gameTime) {
 
     if (m_isScheduledSpawn && m_spawnDelayStartTime != 0) {
         if (gameTime - m_spawnDelayStartTime > m_spawnDelayAdditive) {
-            Vector3 playerPos = ENTITY::GET_ENTITY_COORDS(PLAYER::PLAYER_PED_ID(), true);
+            Vector3 playerPos = frame.playerPos;
             float angle = (float)rand() / RAND_MAX * 6.28318f;
             
             // Use TornadoSpawnDistance setting instead of hardcoded 200-400 range
-            float baseDistance = TornadoMenu::m_tornadoSpawnDistance;
-            float distanceVariation = TornadoMenu::m_tornadoSpawnDistance * 0.5f; // 50% variation
+            float baseDistance = m_settings.tornadoSpawnDistance;
+            float distanceVariation = m_settings.tornadoSpawnDistance * 0.5f; // 50% variation
             float dist = baseDistance + (float)rand() / RAND_MAX * distanceVariation;
             
             // If SpawnInFront is true, bias the angle towards the player's forward direction
-            if (TornadoMenu::m_spawnInFront) {
-                Vector3 playerForward = ENTITY::GET_ENTITY_FORWARD_VECTOR(PLAYER::PLAYER_PED_ID());
+            if (m_settings.spawnInFront) {
+                Vector3 playerForward = ENTITY::GET_ENTITY_FORWARD_VECTOR(frame.playerPed);
                 float playerAngle = std::atan2(playerForward.y, playerForward.x);
                 // Bias angle towards player's forward direction with some randomness
                 angle = playerAngle + ((float)rand() / RAND_MAX - 0.5f) * 1.5708f; // ±90 degrees
@@ -165,28 +173,97 @@ void TornadoFactory::OnUpdate(int gameTime) {
         }
     }
 
+    // One pool walk per scan tick, shared by every vortex that is due to scan
+    bool scanDue = false;
+    for (auto& vortex : m_activeVortexList) {
+        if (!vortex->DespawnRequested && vortex->WantsEntityScan(gameTime, m_settings.maxEntityCount)) {
+            scanDue = true;
+            break;
+        }
+    }
+    if (scanDue) {
+        RebuildEntityGrid();
+
+        // Settle which vortex each entity belongs to before any of them scans
+        float scanRadius = m_settings.maxEntityDistance + TornadoVortex::SCAN_MARGIN;
+        for (auto& vortex : m_activeVortexList) {
+            if (vortex->DespawnRequested) continue;
+            m_entityGrid.ClaimOwners(vortex->GetId(), vortex->GetPosition(), scanRadius);
+        }
+    }
+
     for (auto it = m_activeVortexList.begin(); it != m_activeVortexList.end();) {
         if ((*it)->DespawnRequested) {
-            (*it)->Dispose();
+            (*it)->Retire(m_teardown);
             it = m_activeVortexList.erase(it);
         } else {
-            (*it)->OnUpdate(gameTime);
             ++it;
         }
     }
 
+    m_propPool.SetHighWaterMark(m_settings.propPoolSize);
+
+    // Advance vortices that are still building, a few particles per frame
+    bool building = false;
+    for (auto it = m_activeVortexList.begin(); it != m_activeVortexList.end();) {
+        if ((*it)->IsBuilt()) {
+            ++it;
+            continue;
+        }
+
+        try {
+            (*it)->StepBuild(m_settings, budget);
+        }
+        catch (const std::exception& e) {
+            Logger::Error("Factory: Error during Build: " + std::string(e.what()));
+            (*it)->Retire(m_teardown);
+            it = m_activeVortexList.erase(it);
+            continue;
+        }
+        catch (...) {
+            Logger::Error("Factory: Unknown error during Build");
+            (*it)->Retire(m_teardown);
+            it = m_activeVortexList.erase(it);
+            continue;
+        }
+
+        if ((*it)->IsBuilt()) {
+            Logger::Log("Factory: Build() finished.");
+            m_lastSpawnCompleteTime = gameTime; // OPTIMIZATION: Track completion time
+        } else {
+            building = true;
+        }
+        ++it;
+    }
+    m_spawnInProgress = building;
+
+    // Split what is left of the frame budget evenly; time a vortex doesn't use
+    // flows to the ones after it. The starting vortex rotates every frame.
+    int vortexCount = (int)m_activeVortexList.size();
+    for (int n = 0; n < vortexCount; n++) {
+        int idx = (m_budgetCursor + n) % vortexCount;
+        FrameBudget share(budget.RemainingMicroseconds() / (vortexCount - n));
+        m_activeVortexList[idx]->OnUpdate(frame, m_settings, m_entityGrid, m_entityCache, share);
+    }
+    m_budgetCursor = vortexCount > 0 ? (m_budgetCursor + 1) % vortexCount : 0;
+
+    UpdateParticles(m_settings);
+
+    // Retired funnels get what is left of the frame
+    m_teardown.Update(gameTime, budget);
+
     // Update global sound volumes
     if (m_easHandle != 0) {
-        if (TornadoMenu::m_enableEAS) {
-            AudioManager::Get().SetVolume(m_easHandle, TornadoMenu::m_easVolume);
+        if (m_settings.enableEAS) {
+            AudioManager::Get().SetVolume(m_easHandle, m_settings.easVolume);
         } else {
             AudioManager::Get().Stop(m_easHandle);
             m_easHandle = 0;
         }
     }
     if (m_sirenHandle != 0) {
-        if (TornadoMenu::m_enableSirens) {
-            AudioManager::Get().SetVolume(m_sirenHandle, TornadoMenu::m_sirenVolume);
+        if (m_settings.enableSirens) {
+            AudioManager::Get().SetVolume(m_sirenHandle, m_settings.sirenVolume);
         } else {
             AudioManager::Get().Stop(m_sirenHandle);
             m_sirenHandle = 0;
@@ -194,6 +271,55 @@ void TornadoFactory::OnUpdate(int gameTime) {
     }
 }
 
+void TornadoFactory::RebuildEntityGrid() {
+    TV_PROFILE_ZONE("Factory::RebuildEntityGrid");
+    TV_NATIVE_SCOPE("Factory::RebuildEntityGrid", -1);
+
+    const int POOL_SIZE = 1024;
+    int entities[POOL_SIZE];
+
+    m_entityGrid.Clear();
+
+    auto insertPool = [&](int count, EntityKind kind) {
+        for (int i = 0; i < count; i++) {
+            Entity ent = entities[i];
+            // Goes through the cache so the vortices' checks this frame are free
+            if (!m_entityCache.Exists(ent)) continue;
+            m_entityGrid.Insert(ent, m_entityCache.Coords(ent), kind);
+        }
+    };
+
+    // Insertion order is the pull priority: peds, then vehicles, then objects
+    insertPool(worldGetAllPeds(entities, POOL_SIZE), EntityKind::Ped);
+    insertPool(worldGetAllVehicles(entities, POOL_SIZE), EntityKind::Vehicle);
+    insertPool(worldGetAllObjects(entities, POOL_SIZE), EntityKind::Object);
+
+    m_entityGrid.Build();
+}
+
+void TornadoFactory::UpdateParticles(const TornadoSettings& settings) {
+    TV_PROFILE_ZONE("Factory::UpdateParticles");
+
+    int vortexCount = (int)m_activeVortexList.size();
+    if (vortexCount == 0) return;
+
+    // One frame time read and one angle step for every funnel
+    float angleStep = settings.SignedRotationSpeed() * m_frame.frameTime;
+
+    // Past PROP_MOVES_PER_FRAME props in total, every vortex moves its layers in
+    // turns, so the SET_ENTITY_COORDS count per frame stays flat as vortices are added
+    int totalProps = 0;
+    for (auto& vortex : m_activeVortexList) {
+        totalProps += vortex->GetParticleCount();
+    }
+    int minInterval = (std::max)(1, (totalProps + PROP_MOVES_PER_FRAME - 1) / PROP_MOVES_PER_FRAME);
+    int existenceChecks = (std::max)(MIN_EXISTENCE_CHECKS, EXISTENCE_CHECKS_PER_FRAME / vortexCount);
+
+    for (auto& vortex : m_activeVortexList) {
+        vortex->UpdateParticles(angleStep, existenceChecks, minInterval);
+    }
+}
+
 void TornadoFactory::RemoveAll() {
     m_spawnInProgress = false;
 
@@ -206,22 +332,18 @@ void TornadoFactory::RemoveAll() {
         m_sirenHandle = 0;
     }
 
+    // The funnels fade out over the next frames instead of all at once
     for (auto& vortex : m_activeVortexList) {
-        vortex->Dispose();
+        vortex->Retire(m_teardown);
     }
     m_activeVortexList.clear();
-
-    Ped playerPed = PLAYER::PLAYER_PED_ID();
-    Vector3 playerPos = ENTITY::GET_ENTITY_COORDS(playerPed, true);
-    GRAPHICS::REMOVE_PARTICLE_FX_IN_RANGE(playerPos.x, playerPos.y, playerPos.z, 1000.0f);
-}
-
-void TornadoFactory::RefreshAllVortexSettings() {
-    for (auto& vortex : m_activeVortexList) {
-        vortex->RefreshCachedVars();
-    }
+    m_entityGrid.Clear();
+    m_entityClaims.Clear();
+    m_shapeTests.Clear();
 }
 
 void TornadoFactory::Dispose() {
     RemoveAll();
+    m_teardown.Flush();
+    m_propPool.Clear();
 }
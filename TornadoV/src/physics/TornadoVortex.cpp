@@ -1,32 +1,39 @@
 #include "TornadoVortex.h"
 #include "TornadoParticle.h"
-#include "TornadoMenu.h"
+#include "ParticlePropPool.h"
+#include "AssetCache.h"
+#include "Profiler.h"
+#include "NativeStats.h"
 #include "IniHelper.h"
 #include "Logger.h"
 #include "natives.h"
 #include "MathEx.h"
 #include "AudioManager.h"
+#include "ForceKernel.h"
+#include "EntityClassifier.h"
 #include <algorithm>
 #include <cmath>
 #include <random>
 
-TornadoVortex::TornadoVortex(Vector3 initialPosition, bool neverDespawn)
-    : _position(initialPosition), _destination({ 0.0f, 0, 0.0f, 0, 0.0f, 0 }), _despawnRequested(false), 
-      m_blip(0), _updateFrameCounter(0), m_soundHandle(0) {
+int TornadoVortex::s_nextId = 0;
+
+TornadoVortex::TornadoVortex(Vector3 initialPosition, bool neverDespawn, ParticlePropPool* propPool, EntityClaims* claims, ShapeTestQueue* shapeTests,
+                             const TornadoSettings& settings, const FrameContext& frame)
+    : DespawnRequested(false), _id(s_nextId++), _lod(VortexLod::Near), _lodFrame(0), _propPool(propPool), _claims(claims), _shapeTests(shapeTests),
+      _nextUpdateTime(0), _entityCostMicros(20.0f), _position(initialPosition), _destination({ 0.0f, 0, 0.0f, 0, 0.0f, 0 }), _despawnRequested(false),
+      _updateFrameCounter(0), m_blip(0), m_soundHandle(0) {
     
     Position = initialPosition;
-    _createdTime = GAMEPLAY::GET_GAME_TIMER();
+    _createdTime = frame.gameTime;
     
     // Probability.GetInteger(160000, 600000)
     static std::mt19937 gen(std::random_device{}());
     std::uniform_int_distribution<> dis(160000, 600000);
     _lifeSpan = neverDespawn ? -1 : dis(gen); 
     
-    RefreshCachedVars();
-
     // Start 3D roar
-    if (TornadoMenu::m_enableTornadoSound) {
-        m_soundHandle = AudioManager::Get().Play3D("tornado_loop", _position.x, _position.y, _position.z, TornadoMenu::m_tornadoVolume, true);
+    if (settings.enableTornadoSound) {
+        m_soundHandle = AudioManager::Get().Play3D("tornado_loop", _position.x, _position.y, _position.z, settings.tornadoVolume, true);
     }
 }
 
@@ -34,21 +41,11 @@ TornadoVortex::~TornadoVortex() {
     Dispose();
 }
 
-void TornadoVortex::RefreshCachedVars() {
-    _cachedVerticalForce = TornadoMenu::m_vortexVerticalForceScale;
-    _cachedHorizontalForce = TornadoMenu::m_vortexHorizontalForceScale;
-    _cachedTopSpeed = TornadoMenu::m_vortexMaxEntitySpeed;
-    
-    // Use the values from TornadoMenu which are synchronized with the menu UI
-    MaxEntityDist = TornadoMenu::m_maxEntityDistance;
-    MaxEntityCount = TornadoMenu::m_maxEntityCount;
-    
-    _lastVarCacheTime = GAMEPLAY::GET_GAME_TIMER();
+bool TornadoVortex::WantsEntityScan(int gameTime, int maxEntityCount) const {
+    return gameTime >= _nextUpdateTime && _pulledEntities.Size() < maxEntityCount;
 }
 
-void TornadoVortex::ChangeDestination(bool trackToPlayer) {
-    Ped playerPed = PLAYER::PLAYER_PED_ID();
-    Vector3 playerPos = ENTITY::GET_ENTITY_COORDS(playerPed, true);
+void TornadoVortex::ChangeDestination(bool trackToPlayer, const Vector3& playerPos) {
 
     static std::mt19937 gen(std::random_device{}());
     std::uniform_real_distribution<float> angleDis(0.0f, 6.28318f);
@@ -92,14 +89,16 @@ void TornadoVortex::ChangeDestination(bool trackToPlayer) {
     }
 }
 
-void TornadoVortex::Build() {
+void TornadoVortex::BeginBuild(const TornadoSettings& settings) {
     Logger::Log("Vortex: Build starting...");
-    float radius = IniHelper::GetValue("Vortex", "VortexRadius", 9.4f);
-    int particleCount = IniHelper::GetValue("VortexAdvanced", "ParticlesPerLayer", 9);
-    int maxLayers = IniHelper::GetValue("VortexAdvanced", "MaxParticleLayers", 48);
-    std::string particleAsset = IniHelper::GetValue("VortexAdvanced", "ParticleAsset", "core");
-    std::string particleName = IniHelper::GetValue("VortexAdvanced", "ParticleName", "ent_amb_smoke_foundry");
-    bool enableClouds = TornadoMenu::m_cloudTopEnabled;
+    _build.radius = settings.vortexRadius;
+    int particleCount = settings.particlesPerLayer;
+    int maxLayers = settings.maxParticleLayers;
+    _build.particleAsset = IniHelper::GetValue("VortexAdvanced", "ParticleAsset", "core");
+    _build.particleName = IniHelper::GetValue("VortexAdvanced", "ParticleName", "ent_amb_smoke_foundry");
+    _build.enableClouds = settings.cloudTopEnabled;
+    _build.particleMod = settings.particleMod;
+    _build.maxLayers = (std::max)(maxLayers, 1);
 
     Logger::Log("Vortex: Layers=" + std::to_string(maxLayers) + ", ParticlesPerLayer=" + std::to_string(particleCount));
 
@@ -109,320 +108,373 @@ void TornadoVortex::Build() {
     particleCount = (std::min)(particleCount, 12); // Increased cap for density
     if (particleCount < 1) particleCount = 1; // Prevent division by zero
 
-    int multiplier = 360 / particleCount;
-    float particleSize = 3.0685f;
-    int layers = enableClouds ? 8 : maxLayers;
+    _build.particleCount = particleCount;
+    _build.multiplier = 360 / particleCount;
+    _build.particleSize = 3.0685f;
+    _build.layers = _build.enableClouds ? 8 : maxLayers;
 
-    float layerSepScale = IniHelper::GetValue("VortexAdvanced", "LayerSeparationAmount", 22.0f);
-    if (layerSepScale < 1.0f) layerSepScale = 22.0f; // Safety default if INI is broken
+    _build.layerSepScale = settings.layerSeparation;
+    if (_build.layerSepScale < 1.0f) _build.layerSepScale = 22.0f; // Safety default if INI is broken
 
     Logger::Log("Vortex: Requesting assets...");
     
-    // Ensure assets are loaded before building
-    bool isCore = (particleAsset == "core");
-    if (!isCore) {
-        Logger::Log("Vortex: Requesting PTFX asset: " + particleAsset);
-        STREAMING::REQUEST_NAMED_PTFX_ASSET(const_cast<char*>(particleAsset.c_str()));
-    }
-    
-    Logger::Log("Vortex: Requesting secondary PTFX asset: scr_agencyheistb");
-    STREAMING::REQUEST_NAMED_PTFX_ASSET(const_cast<char*>("scr_agencyheistb"));
-    
-    Hash model = GAMEPLAY::GET_HASH_KEY(const_cast<char*>("prop_beach_volball02"));
-    Logger::Log("Vortex: Requesting model: prop_beach_volball02");
-    STREAMING::REQUEST_MODEL(model);
+    // Shared with other vortices; requested once and released with the last reference
+    AssetCache& cache = AssetCache::Get();
+    _assets.push_back(cache.Acquire(AssetKind::Ptfx, _build.particleAsset));
+    _assets.push_back(cache.Acquire(AssetKind::Ptfx, "scr_agencyheistb"));
+    _assets.push_back(cache.Acquire(AssetKind::Model, ParticlePropPool::PROP_MODEL));
 
-    int timeout = 0;
     Logger::Log("Vortex: Waiting for assets to load (max 5s)...");
-    while (timeout < 300) { // 5 seconds
-        bool ptfx1Loaded = isCore || STREAMING::HAS_NAMED_PTFX_ASSET_LOADED(const_cast<char*>(particleAsset.c_str()));
-        bool ptfx2Loaded = STREAMING::HAS_NAMED_PTFX_ASSET_LOADED(const_cast<char*>("scr_agencyheistb"));
-        bool modelLoaded = STREAMING::HAS_MODEL_LOADED(model);
+}
 
-        if (ptfx1Loaded && ptfx2Loaded && modelLoaded) {
-            Logger::Log("Vortex: All assets loaded.");
-            break;
+bool TornadoVortex::CreateNextParticle() {
+    int layers = _build.layers;
+    int layerIdx = _build.layerIdx;
+    int angle = _build.angle;
+    int particlesThisLayer = (layerIdx > layers - 4) ? _build.particleCount + 2 : _build.particleCount;
+
+    Vector3 pos = _position;
+    pos.z += _build.layerSepScale * layerIdx;
+    Vector3 rot = { (float)(angle * _build.multiplier), 0, 0.0f, 0, 0.0f, 0 }; // Initialize padding
+
+    if (_build.particleMod && layerIdx < 2 && angle % 2 == 0) {
+        auto extraParticle = std::make_unique<TornadoParticle>(this, pos, rot, "scr_agencyheistb", "scr_env_agency3b_smoke", _build.radius, layerIdx, _build.layerSepScale, _build.maxLayers);
+        extraParticle->StartFx(4.7f);
+        
+        // MATCH C# Shocking Event
+        if (ENTITY::DOES_ENTITY_EXIST(extraParticle->Ref)) {
+            DECISIONEVENT::ADD_SHOCKING_EVENT_FOR_ENTITY(86, extraParticle->Ref, 0.0f);
         }
+        
+        AddParticle(std::move(extraParticle));
+    }
 
-        WAIT(0);
-        timeout++;
+    bool isTop = false;
+    if (_build.enableClouds && layerIdx > layers - 3) {
+        pos.z += 12.0f;
+        _build.particleSize += 6.0f;
+        _build.radius += 7.0f;
+        isTop = true;
     }
+
+    auto mainParticle = std::make_unique<TornadoParticle>(this, pos, rot, _build.particleAsset, _build.particleName, _build.radius, layerIdx, _build.layerSepScale, _build.maxLayers, isTop);
+    mainParticle->StartFx(_build.particleSize);
     
-    if (timeout >= 300) {
-        Logger::Log("Vortex: Some assets not loaded after 5s, proceeding anyway.");
+    // MATCH C# Shocking Event
+    if (ENTITY::DOES_ENTITY_EXIST(mainParticle->Ref)) {
+        DECISIONEVENT::ADD_SHOCKING_EVENT_FOR_ENTITY(86, mainParticle->Ref, 0.0f);
     }
 
-    Logger::Log("Vortex: Assets loaded. Building " + std::to_string(layers) + " layers...");
-
-    for (int layerIdx = 0; layerIdx < layers; layerIdx++) {
-        int particlesThisLayer = (layerIdx > layers - 4) ? particleCount + 2 : particleCount;
-
-        for (int angle = 0; angle < particlesThisLayer; angle++) {
-            Vector3 pos = _position;
-            pos.z += layerSepScale * layerIdx;
-            Vector3 rot = { (float)(angle * multiplier), 0, 0.0f, 0, 0.0f, 0 }; // Initialize padding
-
-            if (TornadoMenu::m_particleMod && layerIdx < 2 && angle % 2 == 0) {
-                auto extraParticle = std::make_unique<TornadoParticle>(this, pos, rot, "scr_agencyheistb", "scr_env_agency3b_smoke", radius, layerIdx);
-                extraParticle->StartFx(4.7f);
-                
-                // MATCH C# Shocking Event
-                if (ENTITY::DOES_ENTITY_EXIST(extraParticle->Ref)) {
-                    DECISIONEVENT::ADD_SHOCKING_EVENT_FOR_ENTITY(86, extraParticle->Ref, 0.0f);
-                }
-                
-                _particles.push_back(std::move(extraParticle));
-            }
+    _build.radius += 0.08f * (0.72f * layerIdx);
+    _build.particleSize += 0.01f * (0.12f * layerIdx);
+    AddParticle(std::move(mainParticle));
 
-            bool isTop = false;
-            if (enableClouds && layerIdx > layers - 3) {
-                pos.z += 12.0f;
-                particleSize += 6.0f;
-                radius += 7.0f;
-                isTop = true;
-            }
+    if (++_build.angle < particlesThisLayer)
+        return false;
 
-            auto mainParticle = std::make_unique<TornadoParticle>(this, pos, rot, particleAsset, particleName, radius, layerIdx, isTop);
-            mainParticle->StartFx(particleSize);
-            
-            // MATCH C# Shocking Event
-            if (ENTITY::DOES_ENTITY_EXIST(mainParticle->Ref)) {
-                DECISIONEVENT::ADD_SHOCKING_EVENT_FOR_ENTITY(86, mainParticle->Ref, 0.0f);
-            }
+    TV_LOG_DEBUG("Vortex: Built layer " + std::to_string(layerIdx) + " (" + std::to_string(_particles.size()) + " total particles)");
+    _build.angle = 0;
+    _build.layerIdx++;
+    return _build.layerIdx >= layers;
+}
 
-            radius += 0.08f * (0.72f * layerIdx);
-            particleSize += 0.01f * (0.12f * layerIdx);
-            _particles.push_back(std::move(mainParticle));
+void TornadoVortex::StepBuild(const TornadoSettings& settings, const FrameBudget& budget) {
+    TV_PROFILE_ZONE("Vortex::StepBuild");
+
+    switch (_build.state) {
+    case BuildState::RequestAssets:
+        BeginBuild(settings);
+        _build.state = BuildState::WaitAssets;
+        break;
+
+    case BuildState::WaitAssets: {
+        // AssetCache polls the game once per frame; this only reads its state
+        bool allLoaded = true;
+        bool allSettled = true;
+        for (AssetCache::Key asset : _assets) {
+            allLoaded = allLoaded && AssetCache::Get().IsLoaded(asset);
+            allSettled = allSettled && AssetCache::Get().IsSettled(asset);
+        }
+
+        if (allLoaded) {
+            Logger::Log("Vortex: All assets loaded.");
+        } else if (allSettled) { // 5 seconds
+            Logger::Warn("Vortex: Some assets not loaded after 5s, proceeding anyway.");
+        } else {
+            break;
+        }
+
+        Logger::Log("Vortex: Assets loaded. Building " + std::to_string(_build.layers) + " layers...");
+        _build.state = _build.layers > 0 ? BuildState::CreateParticles : BuildState::Done;
+        break;
+    }
 
-            // Yield more frequently during build to prevent watchdog trigger
-            if (_particles.size() % 10 == 0) {
-                WAIT(0);
+    case BuildState::CreateParticles:
+        // Layers arrive bottom-up over several frames; the vortex is already live meanwhile
+        for (int created = 0; created < MAX_PARTICLES_PER_BUILD_STEP; created++) {
+            if (created > 0 && budget.Expired()) break;
+
+            if (CreateNextParticle()) {
+                Logger::Log("Vortex: Build complete. Total particles: " + std::to_string(_particles.size()));
+                _build.state = BuildState::Done;
+                break;
             }
         }
-        
-        Logger::Log("Vortex: Built layer " + std::to_string(layerIdx) + " (" + std::to_string(_particles.size()) + " total particles)");
+        break;
+
+    case BuildState::Done:
+        break;
     }
-    Logger::Log("Vortex: Build complete. Total particles: " + std::to_string(_particles.size()));
 }
 
-void TornadoVortex::CollectNearbyEntities(int gameTime, float maxDistanceDelta) {
+void TornadoVortex::CollectNearbyEntities(const FrameContext& frame, const TornadoSettings& settings, const EntityGrid& entityGrid, EntityFrameCache& entityCache, const FrameBudget& budget) {
+    int gameTime = frame.gameTime;
     if (gameTime < _nextUpdateTime) return;
+    TV_PROFILE_ZONE("Vortex::CollectNearbyEntities");
+    TV_NATIVE_SCOPE("Vortex::CollectNearbyEntities", _id);
+
+    const int maxEntityCount = settings.maxEntityCount;
+    const float maxDistanceDelta = settings.maxEntityDistance;
     
-    if (_pulledEntities.size() >= MaxEntityCount) {
+    if (_pulledEntities.Size() >= maxEntityCount) {
         // Still scan occasionally to replace invalid entities, but slower
         _nextUpdateTime = gameTime + 2000;
         return;
     }
 
-    const int POOL_SIZE = 1024;
-    int entities[POOL_SIZE];
-    
     static std::mt19937 gen(std::random_device{}());
     std::uniform_real_distribution<float> scalarDis(-1.0f, 1.0f);
 
     int addedTotal = 0;
-    // Increase limit significantly to ensure we don't "skip" entities in large radii
-    // Processing 1024 entities' distance is fast enough for modern CPUs
-    const int MAX_ADD_PER_TICK = 300; 
-
-    // Helper to process entities from a pool
-    auto processPool = [&](int count) {
-        for (int i = 0; i < count; i++) {
-            Entity ent = entities[i];
-            if (!ENTITY::DOES_ENTITY_EXIST(ent)) continue;
-            if (_pulledEntities.count(ent)) continue;
-            if (addedTotal >= MAX_ADD_PER_TICK) break;
-            if (_pulledEntities.size() >= MaxEntityCount) break;
-
-            Vector3 pos = ENTITY::GET_ENTITY_COORDS(ent, true);
-            float dist2d = MathEx::Distance2D(pos, _position);
-            
-            // THOROUGH SCAN: 
-            // 1. Entities entering the outer radius
-            // 2. Entities already inside the radius (anywhere)
-            if (dist2d > maxDistanceDelta + 5.0f) continue;
-            
-            // Don't pull entities that are too high up already
-            if (ENTITY::GET_ENTITY_HEIGHT_ABOVE_GROUND(ent) > 300.0f) continue;
-
-            if (ENTITY::IS_ENTITY_A_PED(ent)) {
-                if (!PED::IS_PED_RAGDOLL(ent)) {
-                    PED::SET_PED_TO_RAGDOLL(ent, 800, 1500, 2, 1, 1, 0);
-                }
-            }
 
-            // Check if this entity is the player (either ped or vehicle player is in)
-            bool isPlayerEntity = false;
-            if (ent == PLAYER::PLAYER_PED_ID()) {
-                isPlayerEntity = true;
-            } else if (ENTITY::IS_ENTITY_A_VEHICLE(ent)) {
-                // Check if player is in this vehicle
-                Ped playerPed = PLAYER::PLAYER_PED_ID();
-                Vehicle playerVehicle = PED::GET_VEHICLE_PED_IS_IN(playerPed, false);
-                if (playerVehicle == ent) {
-                    isPlayerEntity = true;
-                }
+    // THOROUGH SCAN: 
+    // 1. Entities entering the outer radius
+    // 2. Entities already inside the radius (anywhere)
+    // The factory's grid already filtered out dead handles and holds this tick's positions,
+    // so only the cells around our disc are visited. Peds come first, then vehicles, then objects.
+    Ped playerPed = frame.playerPed;
+    Vehicle playerVehicle = frame.playerVehicle;
+
+    _gridCandidates.clear();
+    entityGrid.Query(_position, maxDistanceDelta + SCAN_MARGIN, _gridCandidates);
+
+    for (int idx : _gridCandidates) {
+        // Candidates we run out of budget for are picked up on the next scan tick
+        if (addedTotal >= MIN_ADDS_PER_TICK && budget.Expired()) break;
+        if (_pulledEntities.Size() >= maxEntityCount) break;
+
+        // With several vortices each entity belongs to the closest one only
+        int owner = entityGrid.Owner(idx);
+        if (owner != -1 && owner != _id) continue;
+
+        const GridEntity& candidate = entityGrid.Get(idx);
+        Entity ent = candidate.handle;
+        if (_pulledEntities.Contains(ent)) continue;
+        
+        // Don't pull entities that are too high up already
+        if (entityCache.HeightAboveGround(ent) > 300.0f) continue;
+
+        if (candidate.kind == EntityKind::Ped) {
+            if (!TV_NATIVE(PED::IS_PED_RAGDOLL(ent))) {
+                TV_NATIVE(PED::SET_PED_TO_RAGDOLL(ent, 800, 1500, 2, 1, 1, 0));
             }
+        }
 
-            AddEntity(ActiveEntity(ent, 3.0f * scalarDis(gen), 3.0f * scalarDis(gen), isPlayerEntity));
-            addedTotal++;
+        // Check if this entity is the player (either ped or vehicle player is in)
+        bool isPlayerEntity = false;
+        if (ent == playerPed) {
+            isPlayerEntity = true;
+        } else if (candidate.kind == EntityKind::Vehicle && ent == playerVehicle) {
+            isPlayerEntity = true;
         }
-    };
 
-    // Process all pools. 
-    // We don't stop after Peds if we still have room, ensuring inner vehicles/objects are also caught.
-    processPool(worldGetAllPeds(entities, POOL_SIZE));
-    
-    if (_pulledEntities.size() < MaxEntityCount && addedTotal < MAX_ADD_PER_TICK) {
-        processPool(worldGetAllVehicles(entities, POOL_SIZE));
-    }
+        // Classified once here; the force pass never asks the game what the entity is
+        Hash model = candidate.kind == EntityKind::Vehicle ? entityCache.Model(ent) : 0;
+        unsigned char classification = EntityClassifier::Classify(candidate.kind, model);
 
-    if (_pulledEntities.size() < MaxEntityCount && addedTotal < MAX_ADD_PER_TICK) {
-        processPool(worldGetAllObjects(entities, POOL_SIZE));
+        AddEntity(ActiveEntity(ent, 3.0f * scalarDis(gen), 3.0f * scalarDis(gen), isPlayerEntity, classification), candidate.position, entityCache);
+        addedTotal++;
     }
 
     // 50ms (20 times per second) provides a near-instant response
     int nextUpdateDelay = 50; 
-    if (_pulledEntities.size() >= MaxEntityCount) nextUpdateDelay = 1000;
+    if (_pulledEntities.Size() >= maxEntityCount) nextUpdateDelay = 1000;
+
+    // LOD: nobody can see entities join a distant tornado
+    if (_lod == VortexLod::Mid) nextUpdateDelay *= 2;
+    else if (_lod == VortexLod::Far) nextUpdateDelay *= 8;
 
     _nextUpdateTime = gameTime + nextUpdateDelay;
 }
 
-void TornadoVortex::UpdatePulledEntities(int gameTime, float maxDistanceDelta) {
-    // OPTIMIZATION: Refresh cached vars every 5 seconds instead of reading every frame
-    if (gameTime - _lastVarCacheTime > 5000) {
-        RefreshCachedVars();
-    }
+void TornadoVortex::UpdatePulledEntities(const FrameContext& frame, const TornadoSettings& settings, EntityFrameCache& entityCache, const FrameBudget& budget) {
+    TV_PROFILE_ZONE("Vortex::UpdatePulledEntities");
+    TV_NATIVE_SCOPE("Vortex::UpdatePulledEntities", _id);
 
-    _pendingRemovalEntities.clear();
-    _entitySnapshot.clear();
-    for (auto const& [handle, activeEnt] : _pulledEntities) {
-        _entitySnapshot.push_back({ handle, activeEnt });
-    }
+    if (_pulledEntities.Size() == 0) return;
+
+    // Read once; the loops below only touch locals
+    const float maxDistanceDelta = settings.maxEntityDistance;
+    const float verticalForceScale = settings.verticalForceScale;
+    const float horizontalForceScale = settings.horizontalForceScale;
+    const float topSpeed = settings.maxEntitySpeed;
+    const bool affectPlayer = settings.affectPlayer;
+    const bool playerRumble = settings.enableTornadoSound;
 
-    int processedCount = 0;
-    const int MAX_ENTITIES_PER_FRAME = 500;
+    FrameBudget::Clock::time_point workStart = FrameBudget::Clock::now();
 
     static std::mt19937 gen(std::random_device{}());
     std::uniform_real_distribution<float> floatDis(0.0f, 1.0f);
     std::uniform_real_distribution<float> scalarDis(-1.0f, 1.0f);
 
-    for (auto const& kvp : _entitySnapshot) {
-        int key = kvp.first;
-        ActiveEntity value = kvp.second;
-        Entity entity = value.entity;
+    // Priority: closest to the core first, entities skipped on earlier frames
+    // climb the queue so nothing starves. Uses last frame's cached positions.
+    _serveOrder.clear();
+    for (int i = 0; i < _pulledEntities.Size(); i++) {
+        float dist = MathEx::Distance2D(_pulledEntities.GetPosition(i), _position);
+        _serveOrder.push_back({ dist - _pulledEntities.Starvation(i) * STARVATION_WEIGHT, i });
+    }
+
+    // How many entities the budget affords, from the measured per-entity cost
+    int serveCount = (int)(budget.RemainingMicroseconds() / _entityCostMicros);
+    // Never fewer than MIN_ENTITIES_PER_FRAME, but never more than are held
+    serveCount = (std::min)((std::max)(serveCount, MIN_ENTITIES_PER_FRAME), _pulledEntities.Size());
+    std::partial_sort(_serveOrder.begin(), _serveOrder.begin() + serveCount, _serveOrder.end());
+
+    _pulledEntities.AgeAll();
+
+    // Pass 1: validate entities and gather this frame's batch.
+    // Releases are deferred so the indices in _serveOrder stay valid.
+    _forceBatch.Clear();
+    _releaseList.clear();
+    int served = 0;
+    for (; served < serveCount; served++) {
+        if (served >= MIN_ENTITIES_PER_FRAME && budget.Expired()) break;
+
+        int i = _serveOrder[served].second;
+        Entity entity = _pulledEntities.Handle(i);
+        _pulledEntities.MarkServed(i);
+
+        // A closer vortex took it over on its last scan
+        if (_claims->OwnerOf(entity) != _id) {
+            _releaseList.push_back(entity);
+            continue;
+        }
 
-        // CLEANUP: Always check existence and range for EVERY entity in the snapshot
-        if (!ENTITY::DOES_ENTITY_EXIST(entity)) {
-            ReleaseEntity(key);
+        // CLEANUP: Always check existence and range before applying forces
+        if (!entityCache.Exists(entity)) {
+            _releaseList.push_back(entity);
             continue;
         }
 
-        Vector3 pos = ENTITY::GET_ENTITY_COORDS(entity, true);
+        Vector3 pos = entityCache.Coords(entity);
+        _pulledEntities.SetPosition(i, pos);
         float dist = MathEx::Distance2D(pos, _position);
         
         // Match collection filter to prevent immediate release: maxDistanceDelta + 4.0f
-        if (dist > maxDistanceDelta + 4.0f || ENTITY::GET_ENTITY_HEIGHT_ABOVE_GROUND(entity) > 300.0f) {
-            ReleaseEntity(key);
+        if (dist > maxDistanceDelta + 4.0f || entityCache.HeightAboveGround(entity) > 300.0f) {
+            _releaseList.push_back(entity);
             continue;
         }
 
-        if (processedCount >= MAX_ENTITIES_PER_FRAME) continue;
-        processedCount++;
+        _forceBatch.Push(entity, pos, _pulledEntities.XBias(i), _pulledEntities.YBias(i), _pulledEntities.IsPlayer(i), dist, _pulledEntities.Classification(i));
+    }
+
+    for (Entity entity : _releaseList) {
+        _pulledEntities.Remove(entity);
+        _claims->Release(entity, _id);
+    }
+
+    // Pass 2: pull, lift and tangential directions for the whole batch at once
+    ForceKernel::Compute(_forceBatch, _position);
 
-        // Fix narrowing conversion warnings by using explicit float initializers
-        Vector3 targetPos = { _position.x + value.xBias, 0, _position.y + value.yBias, 0, pos.z, 0 };
-        Vector3 dirVec = MathEx::Subtract(targetPos, pos);
-        if (MathEx::Length(dirVec) < 0.0001f)
+    // Pass 3: issue the game calls
+    for (int k = 0; k < _forceBatch.Size(); k++) {
+        if (!_forceBatch.valid[k])
             continue;
 
-        Vector3 direction = MathEx::Normalize(dirVec);
+        Entity entity = _forceBatch.handles[k];
+        bool isPlayer = _forceBatch.isPlayer[k] != 0;
+        unsigned char classification = _forceBatch.classification[k];
+        float dist = _forceBatch.dist[k];
+
         float forceBias = floatDis(gen);
         float force = ForceScale * (forceBias + forceBias / (std::max)(dist, 1.0f));
 
-        float verticalForce = _cachedVerticalForce;
-        float horizontalForce = _cachedHorizontalForce;
+        float verticalForce = verticalForceScale;
+        float horizontalForce = horizontalForceScale;
 
         // Skip affecting player if the setting is disabled - this must check BEFORE any forces are applied
-        if (value.isPlayer && !TornadoMenu::m_affectPlayer) {
+        if (isPlayer && !affectPlayer) {
             continue;
         }
 
-        if (value.isPlayer) {
+        if (isPlayer) {
             verticalForce *= 1.62f;
             horizontalForce *= 1.2f;
+        }
 
-            if (gameTime - _lastPlayerShapeTestTime > 1000) {
-                int ray = WORLDPROBE::_CAST_RAY_POINT_TO_POINT(pos.x, pos.y, pos.z, targetPos.x, targetPos.y, targetPos.z, 1, entity, 7);
-                BOOL hit;
-                Vector3 endCoords, surfaceNormal;
-                Entity entHit;
-                WORLDPROBE::_GET_RAYCAST_RESULT(ray, &hit, &endCoords, &surfaceNormal, &entHit);
-                _lastRaycastResultFailed = hit;
-                _lastPlayerShapeTestTime = gameTime;
-            }
-
-            if (_lastRaycastResultFailed) continue;
+        // Player and peds behind cover are left alone. The ray toward the core is
+        // answered a frame or more later; until then the last answer stands.
+        if (isPlayer || EntityClassifier::IsPed(classification)) {
+            Vector3 from = { _forceBatch.posX[k], 0, _forceBatch.posY[k], 0, _forceBatch.posZ[k], 0 };
+            Vector3 to = { _position.x + _forceBatch.xBias[k], 0, _position.y + _forceBatch.yBias[k], 0, _forceBatch.posZ[k], 0 };
+            _shapeTests->Request(entity, from, to, frame.gameTime);
+            if (_shapeTests->IsSheltered(entity)) continue;
         }
 
-        Hash model = ENTITY::GET_ENTITY_MODEL(entity);
-        if (VEHICLE::IS_THIS_MODEL_A_PLANE(model)) {
+        if (EntityClassifier::IsPlane(classification)) {
             force *= 6.0f;
             verticalForce *= 6.0f;
         }
 
-        ENTITY::APPLY_FORCE_TO_ENTITY(entity, 3, direction.x * horizontalForce, direction.y * horizontalForce, direction.z * horizontalForce, 
-                                     floatDis(gen), 0.0f, scalarDis(gen), 0, false, true, true, false, true);
+        TV_NATIVE(ENTITY::APPLY_FORCE_TO_ENTITY(entity, 3, _forceBatch.dirX[k] * horizontalForce, _forceBatch.dirY[k] * horizontalForce, _forceBatch.dirZ[k] * horizontalForce, 
+                                     floatDis(gen), 0.0f, scalarDis(gen), 0, false, true, true, false, true));
         
         // Apply Vertical Force
-        // MATCH C# upDir = Vector3.Normalize(new Vector3(_position.X, _position.Y, _position.Z + 1000.0f) - entity.Position);
-        Vector3 upTarget = { _position.x, 0, _position.y, 0, _position.z + 1000.0f, 0 };
-        Vector3 upDir = MathEx::Normalize(MathEx::Subtract(upTarget, pos));
         // SHV APPLY_FORCE_TO_ENTITY_CENTER_OF_MASS: matches Helpers.cs extension (p7=0, p8=1)
-        ENTITY::APPLY_FORCE_TO_ENTITY_CENTER_OF_MASS(entity, 1, upDir.x * verticalForce, upDir.y * verticalForce, upDir.z * verticalForce, 0, 0, 1, 1);
+        TV_NATIVE(ENTITY::APPLY_FORCE_TO_ENTITY_CENTER_OF_MASS(entity, 1, _forceBatch.upX[k] * verticalForce, _forceBatch.upY[k] * verticalForce, _forceBatch.upZ[k] * verticalForce, 0, 0, 1, 1));
         
         // Apply Rotational Force (Cross product)
         // MATCH C# entity.ApplyForceToCenterOfMass(Vector3.Normalize(cross) * force * horizontalForce);
-        Vector3 worldUp = { 0.0f, 0, 0.0f, 0, 1.0f, 0 };
-        Vector3 cross = MathEx::Cross(direction, worldUp);
-        
-        Vector3 normCross = MathEx::Normalize(cross);
-        // SHV APPLY_FORCE_TO_ENTITY_CENTER_OF_MASS: matches Helpers.cs extension (p7=0, p8=1)
-        ENTITY::APPLY_FORCE_TO_ENTITY_CENTER_OF_MASS(entity, 1, normCross.x * force * horizontalForce, normCross.y * force * horizontalForce, normCross.z * force * horizontalForce, 0, 0, 1, 1);
+        TV_NATIVE(ENTITY::APPLY_FORCE_TO_ENTITY_CENTER_OF_MASS(entity, 1, _forceBatch.tanX[k] * force * horizontalForce, _forceBatch.tanY[k] * force * horizontalForce, _forceBatch.tanZ[k] * force * horizontalForce, 0, 0, 1, 1));
 
         // Rumble/Shake for Player
-        if (value.isPlayer && TornadoMenu::m_enableTornadoSound) {
-            CAM::SHAKE_GAMEPLAY_CAM(const_cast<char*>("LARGE_EXPLOSION_SHAKE"), 0.012f * (std::max)(1.0f, 30.0f / (std::max)(dist, 1.0f)));
-            CONTROLS::_SET_CONTROL_NORMAL(0, 214, 0.1f); // Set Rumble
+        if (isPlayer && playerRumble) {
+            TV_NATIVE(CAM::SHAKE_GAMEPLAY_CAM(const_cast<char*>("LARGE_EXPLOSION_SHAKE"), 0.012f * (std::max)(1.0f, 30.0f / (std::max)(dist, 1.0f))));
+            TV_NATIVE(CONTROLS::_SET_CONTROL_NORMAL(0, 214, 0.1f)); // Set Rumble
         }
 
-        if (ENTITY::IS_ENTITY_A_PED(entity)) {
-            if (!PED::IS_PED_RAGDOLL(entity)) {
-                PED::SET_PED_TO_RAGDOLL(entity, 800, 1500, 2, 1, 1, 0);
+        if (EntityClassifier::IsPed(classification)) {
+            if (!TV_NATIVE(PED::IS_PED_RAGDOLL(entity))) {
+                TV_NATIVE(PED::SET_PED_TO_RAGDOLL(entity, 800, 1500, 2, 1, 1, 0));
             }
         }
 
-        ENTITY::SET_ENTITY_MAX_SPEED(entity, _cachedTopSpeed);
+        TV_NATIVE(ENTITY::SET_ENTITY_MAX_SPEED(entity, topSpeed));
     }
 
-    for (int handle : _pendingRemovalEntities) {
-        _pulledEntities.erase(handle);
+    // Feed the cost model used to size next frame's batch
+    if (served > 0) {
+        float elapsed = std::chrono::duration<float, std::micro>(FrameBudget::Clock::now() - workStart).count();
+        _entityCostMicros = _entityCostMicros * 0.9f + (elapsed / served) * 0.1f;
+        _entityCostMicros = (std::max)(_entityCostMicros, 1.0f);
     }
 }
 
-void TornadoVortex::OnUpdate(int gameTime) {
-    if (_lifeSpan > 0 && gameTime - _createdTime > _lifeSpan)
+void TornadoVortex::OnUpdate(const FrameContext& frame, const TornadoSettings& settings, const EntityGrid& entityGrid, EntityFrameCache& entityCache, const FrameBudget& budget) {
+    if (_lifeSpan > 0 && frame.gameTime - _createdTime > _lifeSpan)
         _despawnRequested = true;
 
-    if (TornadoMenu::m_movementEnabled) {
+    if (settings.movementEnabled) {
         if ((_destination.x == 0 && _destination.y == 0) || MathEx::Distance(_position, _destination) < 15.0f)
-            ChangeDestination(TornadoMenu::m_followPlayer);  // Follow based on setting, not distance
+            ChangeDestination(settings.followPlayer, frame.playerPos);  // Follow based on setting, not distance
 
         // REMOVE distance check - let FollowPlayer setting control behavior
         // Tornado should either follow always or never follow, not just when far
         
-        Vector3 vTarget = MathEx::MoveTowards(_position, _destination, TornadoMenu::m_moveSpeedScale * 0.287f);
-        _position = MathEx::Lerp(_position, vTarget, GAMEPLAY::GET_FRAME_TIME() * 20.0f);
+        Vector3 vTarget = MathEx::MoveTowards(_position, _destination, settings.moveSpeedScale * 0.287f);
+        _position = MathEx::Lerp(_position, vTarget, frame.frameTime * 20.0f);
     }
 
     Position = _position;
@@ -430,22 +482,24 @@ void TornadoVortex::OnUpdate(int gameTime) {
 
     // Update sound position
     if (m_soundHandle != 0) {
-        if (TornadoMenu::m_enableTornadoSound) {
+        if (settings.enableTornadoSound) {
             AudioManager::Get().Update3DSound(m_soundHandle, _position.x, _position.y, _position.z);
-            AudioManager::Get().SetVolume(m_soundHandle, TornadoMenu::m_tornadoVolume);
+            AudioManager::Get().SetVolume(m_soundHandle, settings.tornadoVolume);
         } else {
             AudioManager::Get().Stop(m_soundHandle);
             m_soundHandle = 0;
         }
-    } else if (TornadoMenu::m_enableTornadoSound) {
-        m_soundHandle = AudioManager::Get().Play3D("tornado_loop", _position.x, _position.y, _position.z, TornadoMenu::m_tornadoVolume, true);
+    } else if (settings.enableTornadoSound) {
+        m_soundHandle = AudioManager::Get().Play3D("tornado_loop", _position.x, _position.y, _position.z, settings.tornadoVolume, true);
     }
 
-    CollectNearbyEntities(gameTime, MaxEntityDist);
-    UpdatePulledEntities(gameTime, MaxEntityDist);
+    UpdateLod(settings.lodDistance, frame.camPos);
+
+    CollectNearbyEntities(frame, settings, entityGrid, entityCache, budget);
+    UpdatePulledEntities(frame, settings, entityCache, budget);
 
     // Update blip
-    if (TornadoMenu::m_drawBlip) {
+    if (settings.drawBlip) {
         if (m_blip == 0) {
             m_blip = UI::ADD_BLIP_FOR_COORD(_position.x, _position.y, _position.z);
             UI::SET_BLIP_SPRITE(m_blip, 458);
@@ -463,22 +517,77 @@ void TornadoVortex::OnUpdate(int gameTime) {
             m_blip = 0;
         }
     }
+}
+
+void TornadoVortex::UpdateParticles(float angleStep, int existenceChecks, int minInterval) {
+    TV_PROFILE_ZONE("Vortex::UpdateParticles");
+    TV_NATIVE_SCOPE("Vortex::UpdateParticles", _id);
 
-    // MATCH C# behavior: Update particles every frame (no skipping)
-    for (auto& p : _particles) {
-        p->OnUpdate(gameTime);
+    // MATCH C# behavior: orbit angles advance every frame, only the prop moves are thinned
+    _particleSystem.Advance(Position, angleStep);
+
+    int interval = _lod == VortexLod::Far ? 4 : (_lod == VortexLod::Mid ? 2 : 1);
+    interval = (std::max)(interval, minInterval);
+    _lodFrame++;
+
+    _deadParticles.clear();
+    _particleSystem.Apply(existenceChecks, interval, _lodFrame, _deadParticles,
+        [](Entity prop) { return TV_NATIVE(ENTITY::DOES_ENTITY_EXIST(prop)) != 0; },
+        [](Entity prop, float x, float y, float z) { TV_NATIVE(ENTITY::SET_ENTITY_COORDS(prop, x, y, z, false, false, false, false)); });
+    for (int index : _deadParticles) {
+        _particles[index]->RemoveFx();
     }
 }
 
-void TornadoVortex::AddEntity(ActiveEntity entity) {
-    if (ENTITY::DOES_ENTITY_EXIST(entity.entity)) {
-        _pulledEntities[entity.entity] = entity;
+void TornadoVortex::UpdateLod(float lodDistance, const Vector3& camPos) {
+    float dist = MathEx::Distance(camPos, _position);
+
+    // 10% hysteresis so a camera sitting on a boundary doesn't flip the level every frame
+    float nearLimit = lodDistance * (_lod == VortexLod::Near ? 1.1f : 1.0f);
+    float midLimit = lodDistance * 2.0f * (_lod == VortexLod::Far ? 1.0f : 1.1f);
+
+    VortexLod lod = VortexLod::Far;
+    if (dist < nearLimit) lod = VortexLod::Near;
+    else if (dist < midLimit) lod = VortexLod::Mid;
+
+    if (lod == _lod) return;
+
+    bool wasFar = _lod == VortexLod::Far;
+    _lod = lod;
+    if (wasFar != (lod == VortexLod::Far)) {
+        for (auto& p : _particles) {
+            p->SetReducedDetail(lod == VortexLod::Far);
+        }
     }
 }
 
-void TornadoVortex::ReleaseEntity(int handle) {
-    if (std::find(_pendingRemovalEntities.begin(), _pendingRemovalEntities.end(), handle) == _pendingRemovalEntities.end())
-        _pendingRemovalEntities.push_back(handle);
+void TornadoVortex::AddParticle(std::unique_ptr<TornadoParticle> particle) {
+    particle->SetReducedDetail(_lod == VortexLod::Far);
+    _particleSystem.Add(particle->Ref, particle->LayerIndex, particle->GetRotation(), particle->GetRadius(), particle->GetOffsetZ(), particle->GetAngularRate());
+    _particles.push_back(std::move(particle));
+}
+
+void TornadoVortex::AddEntity(ActiveEntity entity, const Vector3& position, EntityFrameCache& entityCache) {
+    if (entityCache.Exists(entity.entity)) {
+        int index = _pulledEntities.Add(entity.entity, entity.xBias, entity.yBias, entity.isPlayer, entity.classification);
+        _pulledEntities.SetPosition(index, position);
+        _claims->Claim(entity.entity, _id);
+    }
+}
+
+void TornadoVortex::Retire(TeardownQueue& teardown) {
+    // Cloud deck first, then the funnel from the top layer down
+    std::stable_sort(_particles.begin(), _particles.end(),
+        [](const std::unique_ptr<TornadoParticle>& a, const std::unique_ptr<TornadoParticle>& b) {
+            if (a->IsCloud != b->IsCloud) return a->IsCloud;
+            return a->LayerIndex > b->LayerIndex;
+        });
+
+    teardown.Push(std::move(_particles), std::move(_assets));
+    _particles.clear();
+    _assets.clear();
+
+    Dispose();
 }
 
 void TornadoVortex::Dispose() {
@@ -494,8 +603,17 @@ void TornadoVortex::Dispose() {
     
     // Clear particles - the unique_ptr destructor will call ~TornadoParticle() -> Dispose()
     _particles.clear();
+    _particleSystem.Clear();
+
+    for (AssetCache::Key asset : _assets) {
+        AssetCache::Get().Release(asset);
+    }
+    _assets.clear();
     
-    _pulledEntities.clear();
-    _pendingRemovalEntities.clear();
-    _entitySnapshot.clear();
+    for (int i = 0; i < _pulledEntities.Size(); i++) {
+        _claims->Release(_pulledEntities.Handle(i), _id);
+    }
+    _pulledEntities.Clear();
+    _forceBatch.Clear();
+    _gridCandidates.clear();
 }
@@ -7,9 +7,13 @@
 #include "MathEx.h"
 #include "script.h"
 #include "keyboard.h"
+#include "Benchmark.h"
+#include "Profiler.h"
+#include "NativeStats.h"
 #include <cmath>
 #include <memory>
 #include <cstdio>
+#include <filesystem>
 
 extern std::unique_ptr<TornadoFactory> g_Factory;
 
@@ -21,6 +25,8 @@ std::vector<Submenu> TornadoMenu::m_submenus;
 DWORD TornadoMenu::m_lastKey = 0;
 DWORD TornadoMenu::m_lastRepeatTime = 0;
 int TornadoMenu::m_repeatCount = 0;
+TornadoSettings TornadoMenu::m_settings;
+FrameContext TornadoMenu::m_frame;
 
 bool TornadoMenu::m_movementEnabled = true;
 bool TornadoMenu::m_reverseRotation = false;
@@ -55,6 +61,10 @@ float TornadoMenu::m_rotationSpeed = 2.4f;
 float TornadoMenu::m_vortexVerticalForceScale = 2.29f;
 float TornadoMenu::m_vortexHorizontalForceScale = 1.7f;
 float TornadoMenu::m_vortexMaxEntitySpeed = 40.0f;
+float TornadoMenu::m_vortexFrameBudget = 3.0f;
+int TornadoMenu::m_propPoolSize = 512;
+bool TornadoMenu::m_multiVortex = false;
+bool TornadoMenu::m_profilerOverlay = false;
 float TornadoMenu::m_tornadoSpawnDistance = 100.0f;
 bool TornadoMenu::m_followPlayer = true;
 bool TornadoMenu::m_spawnInFront = true;
@@ -104,6 +114,18 @@ const float TornadoMenu::TITLE_HEIGHT = 0.08f;
 const float TornadoMenu::OPTION_HEIGHT = 0.035f;
 
 void TornadoMenu::Initialize() {
+    LoadIniSettings();
+    LoadXmlSettings();
+
+    // Initialize resolution tracking
+    GRAPHICS::_GET_SCREEN_ACTIVE_RESOLUTION(&m_lastScreenWidth, &m_lastScreenHeight);
+    m_pixelX = 1.0f / (float)m_lastScreenWidth;
+    m_pixelY = 1.0f / (float)m_lastScreenHeight;
+
+    SetupMenus();
+}
+
+void TornadoMenu::LoadIniSettings() {
     m_movementEnabled = IniHelper::GetValue("Vortex", "MovementEnabled", true);
     m_reverseRotation = IniHelper::GetValue("Vortex", "ReverseRotation", false);
     m_cloudTopEnabled = IniHelper::GetValue("VortexAdvanced", "CloudTopEnabled", true);
@@ -124,6 +146,9 @@ void TornadoMenu::Initialize() {
     m_vortexVerticalForceScale = IniHelper::GetValue("Vortex", "VerticalForceScale", 2.29f);
     m_vortexHorizontalForceScale = IniHelper::GetValue("Vortex", "HorizontalForceScale", 1.7f);
     m_vortexMaxEntitySpeed = IniHelper::GetValue("Vortex", "MaxEntitySpeed", 40.0f);
+    m_vortexFrameBudget = IniHelper::GetValue("VortexAdvanced", "FrameBudgetMs", 3.0f);
+    m_propPoolSize = IniHelper::GetValue("VortexAdvanced", "PropPoolSize", 512);
+    m_multiVortex = IniHelper::GetValue("VortexAdvanced", "MultiVortex", false);
     m_tornadoSpawnDistance = IniHelper::GetValue("Vortex", "TornadoSpawnDistance", 100.0f);
     m_followPlayer = IniHelper::GetValue("Vortex", "FollowPlayer", true);
     m_spawnInFront = IniHelper::GetValue("Vortex", "SpawnInFront", true);
@@ -140,13 +165,15 @@ void TornadoMenu::Initialize() {
     m_easVolume = IniHelper::GetValue("Other", "EasVolume", 1.0f);
     m_lodDistance = IniHelper::GetValue("Other", "LodDistance", 500.0f);
     m_drawBlip = IniHelper::GetValue("Other", "AddBlip", true);
-    
-    m_intStep = XmlHelper::GetInt("MenuConfig.General.IntStep", 5);
-    m_floatStep = XmlHelper::GetFloat("MenuConfig.General.FloatStep", 0.1f);
 
     // Keybinds
     m_toggleKey = StringToKey(IniHelper::GetValue("KeyBinds", "ToggleMenu", "F5"));
     m_tornadoHotkey = StringToKey(IniHelper::GetValue("KeyBinds", "ToggleTornado", "F6"));
+}
+
+void TornadoMenu::LoadXmlSettings() {
+    m_intStep = XmlHelper::GetInt("MenuConfig.General.IntStep", 5);
+    m_floatStep = XmlHelper::GetFloat("MenuConfig.General.FloatStep", 0.1f);
 
     // UI Settings
     m_menuX = XmlHelper::GetFloat("MenuConfig.Position.X", 0.15f);
@@ -185,12 +212,10 @@ void TornadoMenu::Initialize() {
     m_countTextG = m_countTextColor.g;
     m_countTextB = m_countTextColor.b;
 
-    // Initialize resolution tracking
-    GRAPHICS::_GET_SCREEN_ACTIVE_RESOLUTION(&m_lastScreenWidth, &m_lastScreenHeight);
-    m_pixelX = 1.0f / (float)m_lastScreenWidth;
-    m_pixelY = 1.0f / (float)m_lastScreenHeight;
-
-    SetupMenus();
+    // Step sizes are baked into the menu items, so rebuild them on a reload
+    if (!m_submenus.empty()) {
+        SetupMenus();
+    }
 }
 
 void TornadoMenu::SetupMenus() {
@@ -270,6 +295,15 @@ void TornadoMenu::SetupMenus() {
     tornado.items.push_back(MenuItem("Layer Separation Amount", &m_layerSeparation, 1.0f, 100.0f, m_floatStep, []() {
         IniHelper::WriteValue("VortexAdvanced", "LayerSeparationAmount", std::to_string(m_layerSeparation));
     }));
+    tornado.items.push_back(MenuItem("Frame Budget (ms)", &m_vortexFrameBudget, 0.5f, 16.0f, m_floatStep, []() {
+        IniHelper::WriteValue("VortexAdvanced", "FrameBudgetMs", std::to_string(m_vortexFrameBudget));
+    }));
+    tornado.items.push_back(MenuItem("Prop Pool Size", &m_propPoolSize, 0, 2000, m_intStep, []() {
+        IniHelper::WriteValue("VortexAdvanced", "PropPoolSize", std::to_string(m_propPoolSize));
+    }));
+    tornado.items.push_back(MenuItem("Multiple Tornadoes", &m_multiVortex, []() {
+        IniHelper::WriteValue("VortexAdvanced", "MultiVortex", m_multiVortex ? "true" : "false");
+    }));
     tornado.items.push_back(MenuItem("Cloud Top Enabled", &m_cloudTopEnabled, []() {
         IniHelper::WriteValue("VortexAdvanced", "CloudTopEnabled", m_cloudTopEnabled ? "true" : "false");
     }));
@@ -306,6 +340,15 @@ void TornadoMenu::SetupMenus() {
     general.items.push_back(MenuItem("Add Blip", &m_drawBlip, []() {
         IniHelper::WriteValue("Other", "AddBlip", m_drawBlip ? "true" : "false");
     }));
+#ifdef TORNADOV_PROFILE
+    // Freezes the game while it runs; release builds use the tornadov_bench target instead
+    general.items.push_back(MenuItem("Run Benchmarks", []() { RunBenchmarks(); }));
+    general.items.push_back(MenuItem("Profiler Overlay", &m_profilerOverlay));
+    general.items.push_back(MenuItem("Dump Profiler CSV", []() { DumpProfilerCsv(); }));
+#endif
+#ifdef TORNADOV_NATIVE_STATS
+    general.items.push_back(MenuItem("Dump Native Stats", []() { DumpNativeStats(); }));
+#endif
     
     // Note: No manual repair buttons needed - auto-repair handles everything
     
@@ -537,13 +580,55 @@ std::string TornadoMenu::KeyToString(DWORD key) {
     }
 }
 
-void TornadoMenu::RefreshVortexSettings() {
-    if (g_Factory) {
-        g_Factory->RefreshAllVortexSettings();
+const TornadoSettings& TornadoMenu::GetSettings() {
+    TornadoSettings next;
+    next.movementEnabled = m_movementEnabled;
+    next.followPlayer = m_followPlayer;
+    next.moveSpeedScale = m_moveSpeedScale;
+
+    next.maxEntityDistance = m_maxEntityDistance;
+    next.maxEntityCount = m_maxEntityCount;
+    next.verticalForceScale = m_vortexVerticalForceScale;
+    next.horizontalForceScale = m_vortexHorizontalForceScale;
+    next.maxEntitySpeed = m_vortexMaxEntitySpeed;
+    next.affectPlayer = m_affectPlayer;
+    next.frameBudgetMs = m_vortexFrameBudget;
+
+    next.vortexRadius = m_vortexRadius;
+    next.particlesPerLayer = m_particlesPerLayer;
+    next.maxParticleLayers = m_maxParticleLayers;
+    next.layerSeparation = m_layerSeparation;
+    next.rotationSpeed = m_rotationSpeed;
+    next.reverseRotation = m_reverseRotation;
+    next.cloudTopEnabled = m_cloudTopEnabled;
+    next.particleMod = m_particleMod;
+    next.propPoolSize = m_propPoolSize;
+    next.lodDistance = m_lodDistance;
+    next.drawBlip = m_drawBlip;
+
+    next.notifications = m_notifications;
+    next.spawnInStorm = m_spawnInStorm;
+    next.spawnInFront = m_spawnInFront;
+    next.tornadoSpawnDistance = m_tornadoSpawnDistance;
+
+    next.enableTornadoSound = m_enableTornadoSound;
+    next.tornadoVolume = m_tornadoVolume;
+    next.enableSirens = m_enableSirens;
+    next.sirenVolume = m_sirenVolume;
+    next.enableEAS = m_enableEAS;
+    next.easVolume = m_easVolume;
+
+    // Menu edits and hot reloads both land in the statics; publish a new version only when one did
+    next.version = m_settings.version;
+    if (!(next == m_settings)) {
+        next.version = m_settings.version + 1;
+        m_settings = next;
     }
+    return m_settings;
 }
 
-void TornadoMenu::OnTick() {
+void TornadoMenu::OnTick(const FrameContext& frame) {
+    m_frame = frame;
     CheckResolution();
     if (m_visible) {
         // Disable game controls when menu is open
@@ -571,6 +656,33 @@ void TornadoMenu::OnTick() {
         DrawMenu();
         HandleInput();
     }
+
+#ifdef TORNADOV_PROFILE
+    if (m_profilerOverlay) {
+        DrawProfilerOverlay();
+    }
+#endif
+}
+
+void TornadoMenu::DrawProfilerOverlay() {
+    const float x = 0.01f;
+    const float width = 0.34f;
+    const float lineHeight = 0.018f;
+    int zones = Profiler::GetZoneCount();
+
+    float top = 0.30f;
+    float height = lineHeight * (zones + 1) + 0.01f;
+    DrawRect(x + width * 0.5f, top + height * 0.5f, width, height, 0, 0, 0, 160);
+
+    char line[160];
+    sprintf_s(line, "%-28s %7s %7s %7s", "zone (us)", "min", "avg", "p99");
+    DrawText(line, x + 0.004f, top + 0.003f, 0.25f, 0, 255, 255, 255, 255);
+
+    for (int i = 0; i < zones; i++) {
+        Profiler::ZoneStats s = Profiler::GetStats(i);
+        sprintf_s(line, "%-28s %7.1f %7.1f %7.1f", s.name, s.minUs, s.avgUs, s.p99Us);
+        DrawText(line, x + 0.004f, top + 0.003f + lineHeight * (i + 1), 0.25f, 0, 220, 220, 220, 255);
+    }
 }
 
 void TornadoMenu::OnKeyDown(DWORD key) {
@@ -836,19 +948,22 @@ void TornadoMenu::SpawnTornado() {
         return;
     }
 
-    if (g_Factory->GetActiveVortexCount() > 0) {
+    if (g_Factory->GetActiveVortexCount() > 0 && !m_multiVortex) {
         Logger::Log("Menu: Already a tornado active, multi-vortex disabled.");
         return;
     }
 
-    // Original C# logic: remove particles in range and set wind
-    GRAPHICS::REMOVE_PARTICLE_FX_IN_RANGE(0.0f, 0.0f, 0.0f, 500.0f);
+    // Original C# logic: remove particles in range and set wind.
+    // Not while a despawned funnel is still fading out; it cleans up after itself.
+    if (g_Factory->GetActiveVortexCount() == 0 && !g_Factory->IsTearingDown()) {
+        GRAPHICS::REMOVE_PARTICLE_FX_IN_RANGE(0.0f, 0.0f, 0.0f, 500.0f);
+    }
     if (m_spawnInStorm) {
         GAMEPLAY::SET_WIND(70.0f);
     }
 
-    Ped playerPed = PLAYER::PLAYER_PED_ID();
-    Vector3 playerPos = ENTITY::GET_ENTITY_COORDS(playerPed, true);
+    Ped playerPed = m_frame.playerPed;
+    Vector3 playerPos = m_frame.playerPos;
     
     Vector3 spawnPos;
     
@@ -894,7 +1009,7 @@ void TornadoMenu::TeleportToTornado() {
     TornadoVortex* vortex = g_Factory->GetFirstVortex();
     if (vortex) {
         Vector3 pos = vortex->GetPosition();
-        Ped playerPed = PLAYER::PLAYER_PED_ID();
+        Ped playerPed = m_frame.playerPed;
         
         // Teleport player slightly above ground at tornado position
         ENTITY::SET_ENTITY_COORDS_NO_OFFSET(playerPed, pos.x, pos.y, pos.z + 10.0f, false, false, false);
@@ -904,3 +1019,47 @@ void TornadoMenu::TeleportToTornado() {
         }
     }
 }
+
+void TornadoMenu::RunBenchmarks() {
+    // Blocks the script for about 1.5s; only reachable from TORNADOV_PROFILE builds
+    Logger::Log("Menu: Running benchmarks...");
+    std::vector<BenchmarkResult> results = Benchmark::RunAll();
+
+    char* localappdata = getenv("LOCALAPPDATA");
+    std::filesystem::path outPath = std::filesystem::path(localappdata) / "TornadoVStuff" / "TornadoVBench.json";
+
+    if (Benchmark::WriteJson(results, outPath.string())) {
+        Logger::Log("Menu: Benchmark results written to " + outPath.string());
+        IniHelper::ShowNotification("~g~Benchmarks saved to TornadoVBench.json");
+    } else {
+        Logger::Error("Menu: Could not write " + outPath.string());
+        IniHelper::ShowNotification("~r~Could not write benchmark results.");
+    }
+}
+
+void TornadoMenu::DumpProfilerCsv() {
+    char* localappdata = getenv("LOCALAPPDATA");
+    std::filesystem::path outPath = std::filesystem::path(localappdata) / "TornadoVStuff" / "TornadoVProfile.csv";
+
+    if (Profiler::WriteCsv(outPath.string())) {
+        Logger::Log("Menu: Profiler samples written to " + outPath.string());
+        IniHelper::ShowNotification("~g~Profiler saved to TornadoVProfile.csv");
+    } else {
+        Logger::Error("Menu: Could not write " + outPath.string());
+        IniHelper::ShowNotification("~r~Could not write profiler CSV.");
+    }
+}
+
+void TornadoMenu::DumpNativeStats() {
+    char* localappdata = getenv("LOCALAPPDATA");
+    std::filesystem::path outPath = std::filesystem::path(localappdata) / "TornadoVStuff" / "TornadoVNatives.txt";
+
+    if (NativeStats::WriteReport(outPath.string())) {
+        Logger::Log("Menu: Native call report written to " + outPath.string());
+        IniHelper::ShowNotification("~g~Native stats saved to TornadoVNatives.txt");
+        NativeStats::Reset(); // Next dump covers only what happens after this one
+    } else {
+        Logger::Error("Menu: Could not write " + outPath.string());
+        IniHelper::ShowNotification("~r~Could not write native stats.");
+    }
+}
@@ -0,0 +1,113 @@
+#include "AssetCache.h"
+#include "natives.h"
+#include "Logger.h"
+#include <cctype>
+
+AssetCache& AssetCache::Get() {
+    static AssetCache instance;
+    return instance;
+}
+
+Hash AssetCache::HashName(const std::string& name) {
+    // Jenkins one-at-a-time on the lower-cased name (joaat)
+    Hash hash = 0;
+    for (char c : name) {
+        hash += (unsigned char)std::tolower((unsigned char)c);
+        hash += hash << 10;
+        hash ^= hash >> 6;
+    }
+    hash += hash << 3;
+    hash ^= hash >> 11;
+    hash += hash << 15;
+    return hash;
+}
+
+AssetCache::Key AssetCache::Acquire(AssetKind kind, const std::string& name) {
+    Key key = MakeKey(kind, HashName(name));
+
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        it->second.refCount++;
+        return key;
+    }
+
+    Entry entry = { kind, HashName(name), name, 1, 0, AssetState::Loading };
+    if (IsResident(entry)) {
+        entry.state = AssetState::Loaded;
+    } else {
+        Logger::Log("AssetCache: Requesting " + name);
+        Request(entry);
+    }
+    m_entries.emplace(key, entry);
+    return key;
+}
+
+void AssetCache::Release(Key key) {
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) return;
+
+    Entry& entry = it->second;
+    if (--entry.refCount > 0) return;
+
+    if (!IsResident(entry)) {
+        Logger::Log("AssetCache: Releasing " + entry.name);
+        if (entry.kind == AssetKind::Ptfx) {
+            STREAMING::_REMOVE_NAMED_PTFX_ASSET(const_cast<char*>(entry.name.c_str()));
+        } else {
+            STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(entry.hash);
+        }
+    }
+    m_entries.erase(it);
+}
+
+bool AssetCache::IsLoaded(Key key) const {
+    auto it = m_entries.find(key);
+    return it != m_entries.end() && it->second.state == AssetState::Loaded;
+}
+
+bool AssetCache::IsSettled(Key key) const {
+    auto it = m_entries.find(key);
+    return it == m_entries.end() || it->second.state != AssetState::Loading;
+}
+
+void AssetCache::Update() {
+    for (auto& pair : m_entries) {
+        Entry& entry = pair.second;
+        if (entry.state == AssetState::Loaded) continue;
+
+        if (QueryLoaded(entry)) {
+            Logger::Log("AssetCache: Loaded " + entry.name);
+            entry.state = AssetState::Loaded;
+            continue;
+        }
+
+        entry.pendingFrames++;
+        if (entry.pendingFrames % REREQUEST_INTERVAL == 0) {
+            Request(entry);
+        }
+        if (entry.state == AssetState::Loading && entry.pendingFrames >= TIMEOUT_FRAMES) {
+            Logger::Warn("AssetCache: " + entry.name + " not loaded after " + std::to_string(TIMEOUT_FRAMES) + " frames");
+            entry.state = AssetState::TimedOut;
+        }
+    }
+}
+
+bool AssetCache::IsResident(const Entry& entry) {
+    // The core dictionary is always streamed in and must never be removed
+    return entry.kind == AssetKind::Ptfx && entry.name == "core";
+}
+
+void AssetCache::Request(const Entry& entry) {
+    if (entry.kind == AssetKind::Ptfx) {
+        STREAMING::REQUEST_NAMED_PTFX_ASSET(const_cast<char*>(entry.name.c_str()));
+    } else {
+        STREAMING::REQUEST_MODEL(entry.hash);
+    }
+}
+
+bool AssetCache::QueryLoaded(const Entry& entry) {
+    if (entry.kind == AssetKind::Ptfx) {
+        return STREAMING::HAS_NAMED_PTFX_ASSET_LOADED(const_cast<char*>(entry.name.c_str())) != 0;
+    }
+    return STREAMING::HAS_MODEL_LOADED(entry.hash) != 0;
+}
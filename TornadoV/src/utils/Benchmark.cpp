@@ -0,0 +1,398 @@
+#include "Benchmark.h"
+#include "MathEx.h"
+#include "ForceKernel.h"
+#include "ParticleSystem.h"
+#include "EntityGrid.h"
+#include "IniStore.h"
+#include "tinyxml2/tinyxml2.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <random>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const int InputCount = 1024;
+const int SampleCount = 15;
+const double MinSampleNs = 1.0e6; // Each sample runs for at least 1ms
+
+volatile float g_sink = 0.0f; // Keeps results observable so the work isn't optimized away
+
+float Consume(const Vector3& v) {
+    return v.x + v.y + v.z;
+}
+
+// Times fn (which performs opsPerCall operations) and reports ns per operation
+template<class Fn>
+BenchmarkResult Measure(const std::string& name, int opsPerCall, Fn&& fn) {
+    // Calibrate how many calls fill one sample
+    long long calls = 1;
+    while (true) {
+        auto start = Clock::now();
+        for (long long c = 0; c < calls; c++) fn();
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        if (ns >= MinSampleNs || calls >= (1LL << 24)) break;
+        calls *= 2;
+    }
+
+    std::vector<double> samples;
+    samples.reserve(SampleCount);
+    for (int s = 0; s < SampleCount; s++) {
+        auto start = Clock::now();
+        for (long long c = 0; c < calls; c++) fn();
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        samples.push_back(ns / (double)(calls * opsPerCall));
+    }
+    std::sort(samples.begin(), samples.end());
+
+    return { name, calls * opsPerCall, samples[SampleCount / 2], samples.front() };
+}
+
+struct Inputs {
+    std::vector<Vector3> a;
+    std::vector<Vector3> b;
+    std::vector<Quaternion> q;
+    std::vector<float> angles;
+
+    Inputs() {
+        std::mt19937 gen(1234);
+        std::uniform_real_distribution<float> coord(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> angle(-360.0f, 360.0f);
+        for (int i = 0; i < InputCount; i++) {
+            a.push_back({ coord(gen), 0, coord(gen), 0, coord(gen), 0 });
+            b.push_back({ coord(gen), 0, coord(gen), 0, coord(gen), 0 });
+            q.push_back(MathEx::Euler(angle(gen), 0.0f, 0.0f));
+            angles.push_back(angle(gen));
+        }
+    }
+};
+
+void RunMathEx(const Inputs& in, std::vector<BenchmarkResult>& results) {
+    results.push_back(Measure("MathEx/Normalize", InputCount, [&]() {
+        float acc = 0.0f;
+        for (int i = 0; i < InputCount; i++) acc += Consume(MathEx::Normalize(in.a[i]));
+        g_sink = acc;
+    }));
+    results.push_back(Measure("MathEx/Cross", InputCount, [&]() {
+        float acc = 0.0f;
+        for (int i = 0; i < InputCount; i++) acc += Consume(MathEx::Cross(in.a[i], in.b[i]));
+        g_sink = acc;
+    }));
+    results.push_back(Measure("MathEx/MultiplyVector", InputCount, [&]() {
+        float acc = 0.0f;
+        for (int i = 0; i < InputCount; i++) acc += Consume(MathEx::MultiplyVector(in.a[i], in.q[i]));
+        g_sink = acc;
+    }));
+    results.push_back(Measure("MathEx/Euler", InputCount, [&]() {
+        float acc = 0.0f;
+        for (int i = 0; i < InputCount; i++) acc += MathEx::Euler(in.angles[i], 0.0f, 0.0f).w;
+        g_sink = acc;
+    }));
+    results.push_back(Measure("MathEx/MoveTowards", InputCount, [&]() {
+        float acc = 0.0f;
+        for (int i = 0; i < InputCount; i++) acc += Consume(MathEx::MoveTowards(in.a[i], in.b[i], 0.287f));
+        g_sink = acc;
+    }));
+    results.push_back(Measure("MathEx/Lerp", InputCount, [&]() {
+        float acc = 0.0f;
+        for (int i = 0; i < InputCount; i++) acc += Consume(MathEx::Lerp(in.a[i], in.b[i], 0.32f));
+        g_sink = acc;
+    }));
+    results.push_back(Measure("MathEx/CosLut", InputCount, [&]() {
+        float acc = 0.0f;
+        for (int i = 0; i < InputCount; i++) acc += MathEx::Cos(in.angles[i]);
+        g_sink = acc;
+    }));
+    results.push_back(Measure("MathEx/SinLut", InputCount, [&]() {
+        float acc = 0.0f;
+        for (int i = 0; i < InputCount; i++) acc += MathEx::Sin(in.angles[i]);
+        g_sink = acc;
+    }));
+    results.push_back(Measure("std/cos", InputCount, [&]() {
+        float acc = 0.0f;
+        for (int i = 0; i < InputCount; i++) acc += std::cos(in.angles[i] * (float)MathEx::DegToRad);
+        g_sink = acc;
+    }));
+}
+
+void RunForceKernel(const Inputs& in, std::vector<BenchmarkResult>& results) {
+    // A full vortex worth of pulled entities (MaxEntityCount default)
+    const int count = 200;
+    ForceBatch batch;
+    for (int i = 0; i < count; i++) {
+        batch.Push(i + 1, in.a[i], 3.0f * (in.angles[i] / 360.0f), -3.0f * (in.angles[i] / 360.0f), false, 10.0f);
+    }
+    Vector3 core = { 12.0f, 0, -40.0f, 0, 30.0f, 0 };
+
+    results.push_back(Measure("ForceKernel/Compute/200", count, [&]() {
+        ForceKernel::Compute(batch, core);
+        g_sink = batch.tanX[count - 1];
+    }));
+    results.push_back(Measure("ForceKernel/ComputeScalar/200", count, [&]() {
+        ForceKernel::ComputeScalar(batch, core);
+        g_sink = batch.tanX[count - 1];
+    }));
+}
+
+void RunParticleOrbit(const Inputs& in, std::vector<BenchmarkResult>& results) {
+    // Default build: 48 layers of 9 particles
+    const int count = 48 * 9;
+    ParticleSystem system;
+    std::vector<float> refAngles(count, 0.0f);
+    for (int i = 0; i < count; i++) {
+        system.Add(i + 1, i / 9, in.q[i], 9.4f + 0.05f * (i / 9), 22.0f * (i / 9), 0.3f + 0.7f * std::fabs(in.angles[i]) / 360.0f);
+    }
+    Vector3 center = { 12.0f, 0, -40.0f, 0, 30.0f, 0 };
+    const float step = 2.4f * 0.016f;
+
+    results.push_back(Measure("ParticleOrbit/Advance/432", count, [&]() {
+        system.Advance(center, step);
+        g_sink = system.GetPosition(count - 1).z;
+    }));
+
+    // The per-particle path TornadoParticle::OnUpdate used before ParticleSystem
+    results.push_back(Measure("ParticleOrbit/PerParticle/432", count, [&]() {
+        float acc = 0.0f;
+        for (int i = 0; i < count; i++) {
+            float& angle = refAngles[i];
+            if (angle > 6.28318f) angle -= 6.28318f;
+            else if (angle < -6.28318f) angle += 6.28318f;
+
+            Vector3 offset = { 0.0f, 0, 0.0f, 0, 22.0f * (i / 9), 0 };
+            Vector3 relativePos = { 9.4f * std::cos(angle), 0, 9.4f * std::sin(angle), 0, 0.0f, 0 };
+            Vector3 finalPos = MathEx::Add(MathEx::Add(center, offset), MathEx::MultiplyVector(relativePos, in.q[i]));
+            acc += finalPos.z;
+            angle -= step;
+        }
+        g_sink = acc;
+    }));
+}
+
+// One scan tick of the world-side vortex work for 1, 5 and 30 vortices over the
+// same crowd: "Independent" is every vortex walking all entities and pulling
+// everything in range, "Shared" is the factory path (one grid, dominant-vortex
+// ownership, one particle pass with the shared prop-move cap).
+void RunMultiVortex(const Inputs& in, std::vector<BenchmarkResult>& results) {
+    const int entityCount = 2000;
+    const float area = 300.0f; // Entities and cores within +-area metres
+    const float scanRadius = 57.0f + 5.0f;
+    const int particlesPerVortex = 48 * 9;
+    const int propMovesPerFrame = 1024; // TornadoFactory::PROP_MOVES_PER_FRAME
+
+    std::mt19937 gen(99);
+    std::uniform_real_distribution<float> coord(-area, area);
+    std::vector<Vector3> entities;
+    for (int i = 0; i < entityCount; i++) {
+        entities.push_back({ coord(gen), 0, coord(gen), 0, 30.0f, 0 });
+    }
+
+    const int vortexCounts[] = { 1, 5, 30 };
+    for (int vortexCount : vortexCounts) {
+        std::vector<Vector3> cores;
+        std::vector<ParticleSystem> systems(vortexCount);
+        for (int v = 0; v < vortexCount; v++) {
+            cores.push_back({ coord(gen) * 0.5f, 0, coord(gen) * 0.5f, 0, 20.0f, 0 });
+            for (int i = 0; i < particlesPerVortex; i++) {
+                systems[v].Add(i + 1, i / 9, in.q[i], 9.4f + 0.05f * (i / 9), 22.0f * (i / 9), 0.8f);
+            }
+        }
+
+        ForceBatch batch;
+        std::vector<int> deadOut;
+        const float step = 2.4f * 0.016f;
+        auto moveProps = [&](int interval, int frame) {
+            float acc = 0.0f;
+            for (int v = 0; v < vortexCount; v++) {
+                systems[v].Advance(cores[v], step);
+                deadOut.clear();
+                systems[v].Apply(0, interval, frame, deadOut,
+                    [](Entity) { return true; },
+                    [&](Entity, float x, float y, float z) { acc += x + y + z; });
+            }
+            return acc;
+        };
+
+        int frame = 0;
+        results.push_back(Measure("MultiVortex/Independent/" + std::to_string(vortexCount), 1, [&]() {
+            float acc = 0.0f;
+            for (int v = 0; v < vortexCount; v++) {
+                batch.Clear();
+                for (int i = 0; i < entityCount; i++) {
+                    float dist = MathEx::Distance2D(entities[i], cores[v]);
+                    if (dist <= scanRadius) batch.Push(i + 1, entities[i], 1.0f, -1.0f, false, dist);
+                }
+                ForceKernel::Compute(batch, cores[v]);
+                acc += (float)batch.Size();
+            }
+            g_sink = acc + moveProps(1, ++frame);
+        }));
+
+        EntityGrid grid;
+        std::vector<int> candidates;
+        int totalProps = vortexCount * particlesPerVortex;
+        int minInterval = (std::max)(1, (totalProps + propMovesPerFrame - 1) / propMovesPerFrame);
+        results.push_back(Measure("MultiVortex/Shared/" + std::to_string(vortexCount), 1, [&]() {
+            grid.Clear();
+            for (int i = 0; i < entityCount; i++) {
+                grid.Insert(i + 1, entities[i], EntityKind::Ped);
+            }
+            grid.Build();
+            for (int v = 0; v < vortexCount; v++) {
+                grid.ClaimOwners(v, cores[v], scanRadius);
+            }
+
+            float acc = 0.0f;
+            for (int v = 0; v < vortexCount; v++) {
+                batch.Clear();
+                candidates.clear();
+                grid.Query(cores[v], scanRadius, candidates);
+                for (int idx : candidates) {
+                    if (grid.Owner(idx) != v) continue;
+                    const GridEntity& e = grid.Get(idx);
+                    batch.Push(e.handle, e.position, 1.0f, -1.0f, false, MathEx::Distance2D(e.position, cores[v]));
+                }
+                ForceKernel::Compute(batch, cores[v]);
+                acc += (float)batch.Size();
+            }
+            g_sink = acc + moveProps(minInterval, ++frame);
+        }));
+    }
+}
+
+void RunConfig(std::vector<BenchmarkResult>& results) {
+    // Roughly the size of the shipped TornadoV.ini: four sections, ~40 keys with comments
+    const char* sections[] = { "KeyBinds", "Vortex", "VortexAdvanced", "Other" };
+    std::string text = ";-------- Tornado V ASI Configuration File --------\r\n\r\n";
+    std::vector<std::pair<std::string, std::string>> keys;
+    for (int s = 0; s < 4; s++) {
+        text += "[" + std::string(sections[s]) + "]\r\n; Settings group " + std::to_string(s) + "\r\n";
+        for (int k = 0; k < 10; k++) {
+            std::string key = "SettingNumber" + std::to_string(k);
+            text += key + " = " + std::to_string(k * 1.5f) + "\r\n";
+            keys.push_back({ sections[s], key });
+        }
+        text += "\r\n";
+    }
+
+    IniStore store;
+    results.push_back(Measure("Config/IniStore/Parse", 1, [&]() {
+        store.Parse(text);
+        g_sink = (float)store.Size();
+    }));
+
+    const int count = (int)keys.size();
+    results.push_back(Measure("Config/IniStore/GetFloat", count, [&]() {
+        float acc = 0.0f;
+        for (int i = 0; i < count; i++) acc += store.GetFloat(keys[i].first, keys[i].second, 0.0f);
+        g_sink = acc;
+    }));
+    results.push_back(Measure("Config/IniStore/Serialize", 1, [&]() {
+        g_sink = (float)store.Serialize().size();
+    }));
+
+    // A menu_config.xml blown up to 500 groups of 8 colour elements, with comments and entities
+    const int groups = 500;
+    std::string xml = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<MenuConfig>\n";
+    for (int g = 0; g < groups; g++) {
+        xml += "    <!-- Group " + std::to_string(g) + " & friends -->\n    <Group" + std::to_string(g) + " label=\"a &amp; b &lt;" + std::to_string(g) + "&gt;\">\n";
+        for (int e = 0; e < 8; e++) {
+            xml += "        <Color" + std::to_string(e) + " r=\"184\" g=\"162\" b=\"57\" a=\"255\" />\n";
+        }
+        xml += "    </Group" + std::to_string(g) + ">\n";
+    }
+    xml += "</MenuConfig>\n";
+
+    tinyxml2::XMLDocument doc;
+    results.push_back(Measure("Config/TinyXml/Parse/4000", 1, [&]() {
+        doc.Parse(xml.data(), xml.size());
+        g_sink = (float)doc.Arena().BlockCount();
+    }));
+
+    std::vector<std::string> groupNames;
+    for (int g = 0; g < groups; g += 50) groupNames.push_back("Group" + std::to_string(g));
+    const int lookups = (int)groupNames.size();
+    results.push_back(Measure("Config/TinyXml/FirstChildElement", lookups, [&]() {
+        float acc = 0.0f;
+        for (int i = 0; i < lookups; i++) {
+            tinyxml2::XMLElement* group = doc.RootElement()->FirstChildElement(groupNames[i].c_str());
+            acc += group ? (float)group->FirstChildElement("Color7")->AttributeCount() : 0.0f;
+        }
+        g_sink = acc;
+    }));
+    results.push_back(Measure("Config/TinyXml/ToString", 1, [&]() {
+        g_sink = (float)doc.ToString().size();
+    }));
+}
+
+std::string JsonEscape(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+} // namespace
+
+std::vector<BenchmarkResult> Benchmark::RunAll() {
+    Inputs inputs;
+    std::vector<BenchmarkResult> results;
+
+    RunMathEx(inputs, results);
+    RunForceKernel(inputs, results);
+    RunParticleOrbit(inputs, results);
+    RunMultiVortex(inputs, results);
+    RunConfig(results);
+
+    return results;
+}
+
+bool Benchmark::WriteJson(const std::vector<BenchmarkResult>& results, const std::string& path, const std::string& executable) {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) return false;
+
+    time_t now = time(nullptr);
+    struct tm tstruct;
+    char date[32];
+#ifdef _WIN32
+    localtime_s(&tstruct, &now);
+#else
+    localtime_r(&now, &tstruct);
+#endif
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", &tstruct);
+
+#ifdef _DEBUG
+    const char* buildType = "debug";
+#else
+    const char* buildType = "release";
+#endif
+
+    file << "{\n";
+    file << "  \"context\": {\n";
+    file << "    \"date\": \"" << date << "\",\n";
+    file << "    \"executable\": \"" << JsonEscape(executable) << "\",\n";
+    file << "    \"library_build_type\": \"" << buildType << "\"\n";
+    file << "  },\n";
+    file << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& r = results[i];
+        file << "    {\n";
+        file << "      \"name\": \"" << JsonEscape(r.name) << "\",\n";
+        file << "      \"run_name\": \"" << JsonEscape(r.name) << "\",\n";
+        file << "      \"run_type\": \"iteration\",\n";
+        file << "      \"iterations\": " << r.iterations << ",\n";
+        file << "      \"real_time\": " << r.nsPerOp << ",\n";
+        file << "      \"cpu_time\": " << r.nsPerOp << ",\n";
+        file << "      \"min_time\": " << r.nsPerOpMin << ",\n";
+        file << "      \"time_unit\": \"ns\"\n";
+        file << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n";
+    file << "}\n";
+    return true;
+}
@@ -0,0 +1,266 @@
+#include "ConfigWatcher.h"
+#include "IniStore.h"
+#include "IniHelper.h"
+#include "XmlHelper.h"
+#include "TornadoMenu.h"
+#include "Logger.h"
+#include "tinyxml2/tinyxml2.h"
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const int SETTLE_MS = 150; // Editors often save in several steps; let them finish
+
+std::string g_paths[2];
+std::string g_names[2]; // Lower-case file names matched against notifications
+std::atomic<unsigned long long> g_knownHash[2];
+
+std::atomic<std::shared_ptr<const IniStore>> g_pendingIni;
+std::atomic<std::shared_ptr<tinyxml2::XMLDocument>> g_pendingXml;
+
+std::atomic<bool> g_running(false);
+std::thread g_thread;
+
+#ifdef _WIN32
+HANDLE g_stopEvent = NULL;
+#endif
+
+std::string Lower(std::string text) {
+    for (char& c : text) c = (char)tolower((unsigned char)c);
+    return text;
+}
+
+bool ReadText(const std::string& path, std::string& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    out = buffer.str();
+    return true;
+}
+
+void Reload(ConfigFile file) {
+    std::string text;
+    if (!ReadText(g_paths[(int)file], text) || text.empty()) return;
+
+    unsigned long long hash = ConfigWatcher::HashContent(text);
+    if (g_knownHash[(int)file].exchange(hash) == hash) return; // Our own save, or no real change
+
+    if (file == ConfigFile::Ini) {
+        auto store = std::make_shared<IniStore>();
+        store->Parse(text);
+
+        // A save caught halfway (or a stray edit) parses fine but drops settings;
+        // keep the current store until the file is whole again
+        std::string missing = IniHelper::FindMissingSetting(*store);
+        if (!missing.empty()) {
+            Logger::Warn("ConfigWatcher: TornadoV.ini is missing " + missing + ", keeping the current settings");
+            return;
+        }
+        g_pendingIni.store(std::move(store));
+        Logger::Log("ConfigWatcher: TornadoV.ini changed, reloading");
+    } else {
+        auto doc = std::make_shared<tinyxml2::XMLDocument>();
+        if (doc->Parse(text.data(), text.size()) != tinyxml2::XML_SUCCESS) {
+            Logger::Warn("ConfigWatcher: menu_config.xml has errors, keeping the current menu style");
+            return;
+        }
+        g_pendingXml.store(std::move(doc));
+        Logger::Log("ConfigWatcher: menu_config.xml changed, reloading");
+    }
+}
+
+// Collects which of our files a notification batch touched
+void MatchName(const std::string& name, bool changed[2]) {
+    std::string lower = Lower(name);
+    for (int i = 0; i < 2; i++) {
+        if (lower == g_names[i]) changed[i] = true;
+    }
+}
+
+void ReloadChanged(const bool changed[2]) {
+    for (int i = 0; i < 2; i++) {
+        if (changed[i]) Reload((ConfigFile)i);
+    }
+}
+
+#ifdef _WIN32
+void WatchLoop(std::string directory) {
+    HANDLE dir = CreateFileA(directory.c_str(), FILE_LIST_DIRECTORY,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING,
+        FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, NULL);
+    if (dir == INVALID_HANDLE_VALUE) {
+        Logger::Warn("ConfigWatcher: Could not watch " + directory);
+        return;
+    }
+
+    OVERLAPPED overlapped = {};
+    overlapped.hEvent = CreateEventA(NULL, TRUE, FALSE, NULL);
+    alignas(DWORD) char buffer[16 * 1024];
+
+    while (g_running.load()) {
+        ResetEvent(overlapped.hEvent);
+        if (!ReadDirectoryChangesW(dir, buffer, sizeof(buffer), FALSE,
+                FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE,
+                NULL, &overlapped, NULL)) {
+            break;
+        }
+
+        HANDLE waits[2] = { overlapped.hEvent, g_stopEvent };
+        if (WaitForMultipleObjects(2, waits, FALSE, INFINITE) != WAIT_OBJECT_0) {
+            // Wait for the cancel to land so the kernel is done with buffer
+            DWORD ignored = 0;
+            CancelIoEx(dir, &overlapped);
+            GetOverlappedResult(dir, &overlapped, &ignored, TRUE);
+            break;
+        }
+
+        DWORD bytes = 0;
+        if (!GetOverlappedResult(dir, &overlapped, &bytes, FALSE)) break;
+
+        bool changed[2] = { false, false };
+        if (bytes == 0) {
+            changed[0] = changed[1] = true; // Buffer overflowed; recheck both
+        } else {
+            const char* cursor = buffer;
+            while (true) {
+                const FILE_NOTIFY_INFORMATION* info = (const FILE_NOTIFY_INFORMATION*)cursor;
+                int wideLength = (int)(info->FileNameLength / sizeof(WCHAR));
+                char name[MAX_PATH] = {};
+                WideCharToMultiByte(CP_UTF8, 0, info->FileName, wideLength, name, MAX_PATH - 1, NULL, NULL);
+                MatchName(name, changed);
+
+                if (info->NextEntryOffset == 0) break;
+                cursor += info->NextEntryOffset;
+            }
+        }
+
+        if (changed[0] || changed[1]) {
+            if (WaitForSingleObject(g_stopEvent, SETTLE_MS) == WAIT_OBJECT_0) break;
+            ReloadChanged(changed);
+        }
+    }
+
+    CloseHandle(overlapped.hEvent);
+    CloseHandle(dir);
+}
+#else
+void WatchLoop(std::string directory) {
+    int fd = inotify_init1(IN_NONBLOCK);
+    if (fd < 0) return;
+    if (inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+        close(fd);
+        Logger::Warn("ConfigWatcher: Could not watch " + directory);
+        return;
+    }
+
+    alignas(inotify_event) char buffer[16 * 1024];
+    while (g_running.load()) {
+        // Short poll timeout so Stop() is noticed without a wake-up handle
+        pollfd pfd = { fd, POLLIN, 0 };
+        if (poll(&pfd, 1, 200) <= 0) continue;
+
+        bool changed[2] = { false, false };
+        ssize_t length;
+        while ((length = read(fd, buffer, sizeof(buffer))) > 0) {
+            for (char* cursor = buffer; cursor < buffer + length;) {
+                const inotify_event* event = (const inotify_event*)cursor;
+                if (event->len > 0) MatchName(event->name, changed);
+                cursor += sizeof(inotify_event) + event->len;
+            }
+        }
+
+        if (changed[0] || changed[1]) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(SETTLE_MS));
+            ReloadChanged(changed);
+        }
+    }
+
+    close(fd);
+}
+#endif
+
+} // namespace
+
+void ConfigWatcher::Start(const std::string& iniPath, const std::string& xmlPath) {
+    if (g_running.load()) return;
+
+    g_paths[(int)ConfigFile::Ini] = iniPath;
+    g_paths[(int)ConfigFile::Xml] = xmlPath;
+    for (int i = 0; i < 2; i++) {
+        g_names[i] = Lower(fs::path(g_paths[i]).filename().string());
+
+        // What's on disk now is what the helpers just loaded
+        std::string text;
+        g_knownHash[i] = ReadText(g_paths[i], text) ? HashContent(text) : 0;
+    }
+
+#ifdef _WIN32
+    g_stopEvent = CreateEventA(NULL, TRUE, FALSE, NULL);
+#endif
+    g_running = true;
+
+    // Both files live in TornadoVStuff, so one directory watch covers them
+    g_thread = std::thread(WatchLoop, fs::path(iniPath).parent_path().string());
+}
+
+void ConfigWatcher::Stop() {
+    if (!g_running.exchange(false)) return;
+
+#ifdef _WIN32
+    if (g_stopEvent) SetEvent(g_stopEvent);
+#endif
+    if (g_thread.joinable()) {
+        g_thread.detach();
+    }
+}
+
+void ConfigWatcher::Apply() {
+    if (std::shared_ptr<const IniStore> ini = TakeIni()) {
+        IniHelper::Adopt(*ini);
+        TornadoMenu::LoadIniSettings();
+    }
+
+    if (std::shared_ptr<tinyxml2::XMLDocument> xml = TakeXml()) {
+        XmlHelper::Adopt(std::move(xml));
+        TornadoMenu::LoadXmlSettings();
+    }
+}
+
+void ConfigWatcher::NoteContent(ConfigFile file, const std::string& text) {
+    g_knownHash[(int)file] = HashContent(text);
+}
+
+unsigned long long ConfigWatcher::HashContent(const std::string& text) {
+    // FNV-1a
+    unsigned long long hash = 14695981039346656037ULL;
+    for (char c : text) {
+        hash ^= (unsigned char)c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::shared_ptr<const IniStore> ConfigWatcher::TakeIni() {
+    return g_pendingIni.exchange(nullptr);
+}
+
+std::shared_ptr<tinyxml2::XMLDocument> ConfigWatcher::TakeXml() {
+    return g_pendingXml.exchange(nullptr);
+}
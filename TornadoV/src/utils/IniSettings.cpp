@@ -0,0 +1,138 @@
+// IniHelper's resident store and the settings it must hold. Nothing here
+// touches Win32 resources or natives, so the headless build links it as-is;
+// IniHelper.cpp keeps deployment and notifications.
+#include "IniHelper.h"
+#include <chrono>
+#include "Logger.h"
+#include "ConfigWatcher.h"
+
+namespace {
+
+const long long SAVE_DELAY_MS = 750; // Quiet time after the last write before saving
+
+std::chrono::steady_clock::time_point g_lastChange;
+
+} // namespace
+
+std::string IniHelper::IniPath = "";
+IniStore IniHelper::Store;
+
+const std::vector<IniHelper::IniSetting>& IniHelper::RequiredSettings() {
+    static const std::vector<IniSetting> settings = {
+        // KeyBinds section
+        {"KeyBinds", "KeybindsEnabled", "true"},
+        {"KeyBinds", "ToggleMenu", "F5"},
+        {"KeyBinds", "ToggleTornado", "F6"},
+        
+        // Vortex section
+        {"Vortex", "MovementEnabled", "true"},
+        {"Vortex", "MoveSpeedScale", "1.0"},
+        {"Vortex", "MaxEntitySpeed", "45.0"},
+        {"Vortex", "MaxEntityDistance", "57.0"},
+        {"Vortex", "MaxEntityCount", "200"},
+        {"Vortex", "HorizontalForceScale", "2.0"},
+        {"Vortex", "VerticalForceScale", "1.6"},
+        {"Vortex", "VortexRadius", "9.4"},
+        {"Vortex", "RotationSpeed", "2.4"},
+        {"Vortex", "ReverseRotation", "false"},
+        {"Vortex", "TornadoSpawnDistance", "100.0"},
+        {"Vortex", "FollowPlayer", "true"},
+        {"Vortex", "SpawnInFront", "true"},
+        {"Vortex", "TornadoMaxDistance", "1000.0"},
+        
+        // VortexAdvanced section
+        {"VortexAdvanced", "MaxParticleLayers", "47"},
+        {"VortexAdvanced", "ParticlesPerLayer", "9"},
+        {"VortexAdvanced", "LayerSeparationAmount", "22.0"},
+        {"VortexAdvanced", "FrameBudgetMs", "3.0"},
+        {"VortexAdvanced", "PropPoolSize", "512"},
+        {"VortexAdvanced", "MultiVortex", "false"},
+        {"VortexAdvanced", "CloudTopEnabled", "true"},
+        {"VortexAdvanced", "CloudTopParticlesEnabled", "true"},
+        {"VortexAdvanced", "ParticleMod", "false"},
+        {"VortexAdvanced", "SurfaceDetectionEnabled", "true"},
+        {"VortexAdvanced", "UseInternalPool", "true"},
+        {"VortexAdvanced", "ParticleName", "ent_amb_smoke_foundry"},
+        {"VortexAdvanced", "ParticleAsset", "core"},
+        
+        // Other section
+        {"Other", "Notifications", "true"},
+        {"Other", "SpawnInStorm", "true"},
+        {"Other", "AffectPlayer", "true"},
+        {"Other", "EnableEAS", "true"},
+        {"Other", "EnableSirens", "true"},
+        {"Other", "EnableTornadoSound", "true"},
+        {"Other", "SirenVolume", "1.0"},
+        {"Other", "TornadoVolume", "1.0"},
+        {"Other", "EasVolume", "1.0"},
+        {"Other", "LodDistance", "500.0"},
+        {"Other", "AddBlip", "true"}
+    };
+    return settings;
+}
+
+std::string IniHelper::FindMissingSetting(const IniStore& store) {
+    for (const IniSetting& setting : RequiredSettings()) {
+        if (!store.Has(setting.section, setting.key)) {
+            return "[" + setting.section + "] " + setting.key;
+        }
+    }
+    return "";
+}
+
+void IniHelper::WriteValue(const std::string& section, const std::string& key, const std::string& value) {
+    if (!Store.Set(section, key, value)) return;
+    g_lastChange = std::chrono::steady_clock::now();
+}
+
+void IniHelper::Update() {
+    if (!Store.IsDirty()) return;
+
+    // Coalesce bursts (e.g. holding a slider) into one save once input settles
+    auto now = std::chrono::steady_clock::now();
+    if (std::chrono::duration_cast<std::chrono::milliseconds>(now - g_lastChange).count() < SAVE_DELAY_MS) return;
+
+    if (!Save()) {
+        Logger::Error("Failed to save INI settings");
+        g_lastChange = now; // Retry after another delay rather than every frame
+    }
+}
+
+void IniHelper::Shutdown() {
+    if (Store.IsDirty() && !Save()) {
+        Logger::Error("Failed to save INI settings on shutdown");
+    }
+}
+
+bool IniHelper::Save() {
+    // Serialize once; tell the watcher first so the rename doesn't read back as an outside edit
+    std::string text = Store.Serialize();
+    ConfigWatcher::NoteContent(ConfigFile::Ini, text);
+    return Store.Flush(IniPath, text);
+}
+
+void IniHelper::Adopt(const IniStore& store) {
+    Store = store;
+}
+
+void IniHelper::ValidateAndRepairConfig() {
+    bool repairsMade = false;
+    
+    // Check each setting and repair if missing
+    for (const IniSetting& setting : RequiredSettings()) {
+        if (Store.GetString(setting.section, setting.key, "").empty()) {
+            // Setting is missing, repair it in memory and save once below
+            Store.Set(setting.section, setting.key, setting.defaultValue);
+            repairsMade = true;
+            Logger::Log("Repaired missing INI setting: [" + setting.section + "] " + setting.key + " = " + setting.defaultValue);
+        }
+    }
+    
+    if (repairsMade) {
+        if (!Save()) {
+            Logger::Error("Failed to save repaired INI file");
+        }
+        ShowNotification("~g~Tornado V: INI file repaired successfully!");
+        Logger::Log("INI validation and repair completed");
+    }
+}
@@ -0,0 +1,301 @@
+#include "IniStore.h"
+#include <cctype>
+#include <climits>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::string Trim(const std::string& text) {
+    size_t start = 0;
+    size_t end = text.size();
+    while (start < end && std::isspace((unsigned char)text[start])) start++;
+    while (end > start && std::isspace((unsigned char)text[end - 1])) end--;
+    return text.substr(start, end - start);
+}
+
+} // namespace
+
+unsigned long long IniStore::HashKey(const std::string& section, const std::string& key) {
+    // FNV-1a over "section\x1fkey", lower-cased on the fly
+    unsigned long long hash = 14695981039346656037ULL;
+    for (char c : section) {
+        hash ^= (unsigned char)std::tolower((unsigned char)c);
+        hash *= 1099511628211ULL;
+    }
+    hash ^= 0x1f;
+    hash *= 1099511628211ULL;
+    for (char c : key) {
+        hash ^= (unsigned char)std::tolower((unsigned char)c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::string IniStore::Lower(const std::string& text) {
+    std::string out = text;
+    for (char& c : out) c = (char)std::tolower((unsigned char)c);
+    return out;
+}
+
+void IniStore::SetEntryValue(Entry& entry, const std::string& value) {
+    entry.value = value;
+
+    // Same leading-number rule std::stof/stoi applied to the raw string
+    const char* start = value.c_str();
+    char* end = nullptr;
+    entry.number = std::strtod(start, &end);
+    entry.isNumber = end != start;
+    entry.flag = (value == "true" || value == "1" || value == "yes");
+}
+
+void IniStore::Clear() {
+    m_lines.clear();
+    m_entries.clear();
+    m_sections.clear();
+    m_index.clear();
+    m_crlf = true;
+    m_bom = false;
+    m_dirty = false;
+}
+
+bool IniStore::Load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    Parse(buffer.str());
+    return true;
+}
+
+void IniStore::Parse(const std::string& text) {
+    Clear();
+
+    size_t pos = 0;
+    if (text.compare(0, 3, "\xEF\xBB\xBF") == 0) {
+        m_bom = true;
+        pos = 3;
+    }
+    m_crlf = text.find('\n') == std::string::npos || text.find("\r\n") != std::string::npos;
+
+    int currentSection = -1;
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == std::string::npos) end = text.size();
+
+        size_t lineEnd = end;
+        if (lineEnd > pos && text[lineEnd - 1] == '\r') lineEnd--;
+        AddLine(text.substr(pos, lineEnd - pos), currentSection);
+
+        pos = end + 1;
+    }
+}
+
+void IniStore::AddLine(const std::string& raw, int& currentSection) {
+    Line line = { LineKind::Text, raw, 0, -1, false };
+    std::string trimmed = Trim(raw);
+
+    if (!trimmed.empty() && trimmed[0] == '[') {
+        size_t close = trimmed.find(']');
+        if (close != std::string::npos) {
+            std::string name = Lower(Trim(trimmed.substr(1, close - 1)));
+
+            currentSection = -1;
+            for (size_t i = 0; i < m_sections.size(); i++) {
+                if (m_sections[i].name == name) currentSection = (int)i;
+            }
+            if (currentSection < 0) {
+                m_sections.push_back({ name, m_lines.size() });
+                currentSection = (int)m_sections.size() - 1;
+            }
+            line.kind = LineKind::Section;
+        }
+    } else if (!trimmed.empty() && trimmed[0] != ';' && trimmed[0] != '#' && currentSection >= 0) {
+        size_t eq = raw.find('=');
+        if (eq != std::string::npos) {
+            std::string key = Trim(raw.substr(0, eq));
+            const std::string& section = m_sections[currentSection].name;
+
+            // The first occurrence wins, as with GetPrivateProfileString; repeats stay as text
+            if (!key.empty() && !Find(section, key)) {
+                size_t valueStart = eq + 1;
+                while (valueStart < raw.size() && std::isspace((unsigned char)raw[valueStart])) valueStart++;
+
+                std::string value = Trim(raw.substr(valueStart));
+                if (value.size() >= 2 && (value.front() == '"' || value.front() == '\'') && value.back() == value.front()) {
+                    value = value.substr(1, value.size() - 2);
+                }
+
+                Entry entry;
+                entry.section = section;
+                entry.key = Lower(key);
+                entry.line = m_lines.size();
+                SetEntryValue(entry, value);
+
+                m_entries.push_back(entry);
+                m_index.emplace(HashKey(section, key), (int)m_entries.size() - 1);
+
+                line.kind = LineKind::Key;
+                line.valueStart = valueStart;
+                line.entry = (int)m_entries.size() - 1;
+            }
+            m_sections[currentSection].lastLine = m_lines.size();
+        }
+    }
+
+    m_lines.push_back(line);
+}
+
+std::string IniStore::Serialize() const {
+    const char* newline = m_crlf ? "\r\n" : "\n";
+
+    std::string out;
+    if (m_bom) out += "\xEF\xBB\xBF";
+    for (const Line& line : m_lines) {
+        if (line.kind == LineKind::Key && line.edited) {
+            out.append(line.text, 0, line.valueStart);
+            out += m_entries[line.entry].value;
+        } else {
+            out += line.text;
+        }
+        out += newline;
+    }
+    return out;
+}
+
+bool IniStore::Flush(const std::string& path) {
+    if (!m_dirty) return true;
+    return Flush(path, Serialize());
+}
+
+bool IniStore::Flush(const std::string& path, const std::string& text) {
+    if (!m_dirty) return true;
+
+    // Write next to the target and swap it in, so a crash never leaves a half-written INI
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+
+        file.write(text.data(), (std::streamsize)text.size());
+        if (!file.good()) return false;
+    }
+
+    std::error_code ec;
+    fs::rename(tempPath, path, ec);
+    if (ec) {
+        fs::remove(tempPath, ec);
+        return false;
+    }
+
+    m_dirty = false;
+    return true;
+}
+
+const IniStore::Entry* IniStore::Find(const std::string& section, const std::string& key) const {
+    auto range = m_index.equal_range(HashKey(section, key));
+    if (range.first == range.second) return nullptr;
+
+    std::string lowerSection = Lower(section);
+    std::string lowerKey = Lower(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        const Entry& entry = m_entries[it->second];
+        if (entry.section == lowerSection && entry.key == lowerKey) return &entry;
+    }
+    return nullptr;
+}
+
+std::string IniStore::GetString(const std::string& section, const std::string& key, const std::string& defaultValue) const {
+    const Entry* entry = Find(section, key);
+    if (!entry || entry->value.empty()) return defaultValue;
+    return entry->value;
+}
+
+bool IniStore::GetBool(const std::string& section, const std::string& key, bool defaultValue) const {
+    const Entry* entry = Find(section, key);
+    if (!entry || entry->value.empty()) return defaultValue;
+    return entry->flag;
+}
+
+int IniStore::GetInt(const std::string& section, const std::string& key, int defaultValue) const {
+    const Entry* entry = Find(section, key);
+    if (!entry || !entry->isNumber) return defaultValue;
+    if (entry->number < (double)INT_MIN || entry->number > (double)INT_MAX) return defaultValue;
+    return (int)entry->number;
+}
+
+float IniStore::GetFloat(const std::string& section, const std::string& key, float defaultValue) const {
+    const Entry* entry = Find(section, key);
+    if (!entry || !entry->isNumber) return defaultValue;
+    return (float)entry->number;
+}
+
+double IniStore::GetDouble(const std::string& section, const std::string& key, double defaultValue) const {
+    const Entry* entry = Find(section, key);
+    if (!entry || !entry->isNumber) return defaultValue;
+    return entry->number;
+}
+
+bool IniStore::Set(const std::string& section, const std::string& key, const std::string& value) {
+    const Entry* found = Find(section, key);
+    if (found) {
+        if (found->value == value) return false;
+
+        Entry& entry = m_entries[found - m_entries.data()];
+        SetEntryValue(entry, value);
+        m_lines[entry.line].edited = true;
+        m_dirty = true;
+        return true;
+    }
+
+    std::string lowerSection = Lower(section);
+    int sectionIdx = -1;
+    for (size_t i = 0; i < m_sections.size(); i++) {
+        if (m_sections[i].name == lowerSection) sectionIdx = (int)i;
+    }
+
+    if (sectionIdx < 0) {
+        // New section at the end of the file, separated by a blank line
+        if (!m_lines.empty() && !Trim(m_lines.back().text).empty()) {
+            m_lines.push_back({ LineKind::Text, "", 0, -1, false });
+        }
+        m_sections.push_back({ lowerSection, m_lines.size() });
+        m_lines.push_back({ LineKind::Section, "[" + section + "]", 0, -1, false });
+        sectionIdx = (int)m_sections.size() - 1;
+    }
+
+    Entry entry;
+    entry.section = lowerSection;
+    entry.key = Lower(key);
+    entry.line = 0;
+    SetEntryValue(entry, value);
+    m_entries.push_back(entry);
+    int entryIdx = (int)m_entries.size() - 1;
+    m_index.emplace(HashKey(section, key), entryIdx);
+
+    std::string prefix = key + " = ";
+    size_t at = m_sections[sectionIdx].lastLine + 1;
+    InsertLine(at, { LineKind::Key, prefix, prefix.size(), entryIdx, true });
+    m_entries[entryIdx].line = at;
+    m_sections[sectionIdx].lastLine = at;
+
+    m_dirty = true;
+    return true;
+}
+
+void IniStore::InsertLine(size_t at, const Line& line) {
+    m_lines.insert(m_lines.begin() + at, line);
+
+    // Keep the line numbers held by entries and sections pointing at the same lines
+    for (Entry& entry : m_entries) {
+        if (entry.line >= at) entry.line++;
+    }
+    for (SectionInfo& section : m_sections) {
+        if (section.lastLine >= at) section.lastLine++;
+    }
+}
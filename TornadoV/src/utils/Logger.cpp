@@ -1,54 +1,209 @@
 #include "Logger.h"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
-#include <iomanip>
-#include <iostream>
+#include <cstring>
+#include <ctime>
 #include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
 
-std::string Logger::m_filePath = "";
-std::mutex Logger::m_mutex;
+namespace {
+
+const size_t RingSize = 1024; // Power of two
+const size_t RingMask = RingSize - 1;
+const size_t MaxMessage = 240;
+
+struct Record {
+    long long timeMs;
+    LogLevel level;
+    unsigned short length;
+    char text[MaxMessage];
+};
+
+// Vyukov bounded queue: each cell's sequence says whose turn it is
+struct Cell {
+    std::atomic<size_t> sequence;
+    Record record;
+};
+
+Cell g_ring[RingSize];
+std::atomic<size_t> g_enqueuePos(0);
+std::atomic<size_t> g_dequeuePos(0);
+std::atomic<uint64_t> g_dropped(0);
+uint64_t g_droppedReported = 0;
+
+std::atomic<bool> g_initialized(false);
+std::atomic<bool> g_running(false);
+std::thread g_writer;
+std::timed_mutex g_fileMutex; // Consumer side only; producers never touch it
+const std::chrono::milliseconds SHUTDOWN_LOCK_TIMEOUT(250);
+std::ofstream g_file;
+
+bool Enqueue(LogLevel level, const std::string& message) {
+    Cell* cell;
+    size_t pos = g_enqueuePos.load(std::memory_order_relaxed);
+    while (true) {
+        cell = &g_ring[pos & RingMask];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (g_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            return false; // Full
+        } else {
+            pos = g_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    Record& record = cell->record;
+    record.timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    record.level = level;
+    record.length = (unsigned short)(std::min)(message.size(), MaxMessage);
+    std::memcpy(record.text, message.data(), record.length);
+
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool Dequeue(Record& out) {
+    Cell* cell;
+    size_t pos = g_dequeuePos.load(std::memory_order_relaxed);
+    while (true) {
+        cell = &g_ring[pos & RingMask];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (g_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            return false; // Empty
+        } else {
+            pos = g_dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    out = cell->record;
+    cell->sequence.store(pos + RingMask + 1, std::memory_order_release);
+    return true;
+}
+
+const char* LevelPrefix(LogLevel level) {
+    switch (level) {
+    case LogLevel::Debug: return "[DEBUG] ";
+    case LogLevel::Warn: return "[WARN] ";
+    case LogLevel::Error: return "[ERROR] ";
+    default: return "";
+    }
+}
+
+void WriteRecord(const Record& record) {
+    time_t seconds = (time_t)(record.timeMs / 1000);
+    struct tm timeinfo;
+#ifdef _WIN32
+    localtime_s(&timeinfo, &seconds);
+#else
+    localtime_r(&seconds, &timeinfo);
+#endif
+
+    char stamp[24];
+    snprintf(stamp, sizeof(stamp), "[%02d:%02d:%02d.%03d] ", timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec, (int)(record.timeMs % 1000));
+
+    g_file << stamp << LevelPrefix(record.level);
+    g_file.write(record.text, record.length);
+    g_file << '\n';
+}
+
+} // namespace
 
 void Logger::Initialize(const std::string& filePath) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_filePath = filePath;
-    
+    if (g_initialized.load()) return;
+
+    for (size_t i = 0; i < RingSize; i++) {
+        g_ring[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
     // Create directory if it doesn't exist
-    std::filesystem::path p(m_filePath);
+    std::filesystem::path p(filePath);
     if (p.has_parent_path()) {
         std::filesystem::create_directories(p.parent_path());
     }
-    
+
     // Clear the log file on startup
-    std::ofstream file(m_filePath, std::ios::out | std::ios::trunc);
-    if (file.is_open()) {
-        file << "--- Tornado V Enhanced Log Started ---" << std::endl;
-        file.close();
+    g_file.open(filePath, std::ios::out | std::ios::trunc);
+    if (!g_file.is_open()) return;
+    g_file << "--- Tornado V Enhanced Log Started ---" << std::endl;
+
+    g_running = true;
+    g_initialized = true;
+    g_writer = std::thread(WriterLoop);
+}
+
+void Logger::Shutdown() {
+    if (!g_initialized.exchange(false)) return;
+    g_running = false;
+
+    // From DLL_PROCESS_DETACH the writer may have been terminated mid-drain and
+    // still own the lock. Give up on the final drain then; the OS closes the file.
+    {
+        std::unique_lock<std::timed_mutex> lock(g_fileMutex, SHUTDOWN_LOCK_TIMEOUT);
+        if (lock.owns_lock()) {
+            DrainLocked();
+            g_file.close();
+        }
+    }
+
+    // The writer exits on its own once it sees g_running cleared
+    if (g_writer.joinable()) {
+        g_writer.detach();
     }
 }
 
-void Logger::Log(const std::string& message) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    if (m_filePath.empty()) return; // Don't log if not initialized
+void Logger::Write(LogLevel level, const std::string& message) {
+    if (!g_initialized.load(std::memory_order_relaxed)) return; // Don't log if not initialized
+
+    if (!Enqueue(level, message)) {
+        g_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+uint64_t Logger::GetDroppedCount() {
+    return g_dropped.load(std::memory_order_relaxed);
+}
+
+void Logger::DrainLocked() {
+    if (!g_file.is_open()) return;
 
     try {
-        std::ofstream file(m_filePath, std::ios::out | std::ios::app);
-        if (file.is_open()) {
-            auto now = std::chrono::system_clock::now();
-            auto time = std::chrono::system_clock::to_time_t(now);
-            struct tm timeinfo;
-            localtime_s(&timeinfo, &time);
-            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-            
-            file << "[" << std::put_time(&timeinfo, "%H:%M:%S") << "." 
-                 << std::setfill('0') << std::setw(3) << ms.count() << "] " 
-                 << message << std::endl;
-            file.flush();
-            file.close();
+        Record record;
+        bool wrote = false;
+        while (Dequeue(record)) {
+            WriteRecord(record);
+            wrote = true;
         }
+
+        uint64_t dropped = g_dropped.load(std::memory_order_relaxed);
+        if (dropped != g_droppedReported) {
+            g_file << "[WARN] " << (dropped - g_droppedReported) << " log records dropped (ring full)\n";
+            g_droppedReported = dropped;
+            wrote = true;
+        }
+
+        if (wrote) g_file.flush();
     } catch (...) {
         // Silently fail to avoid recursive crashes or deadlocks if logging itself fails
     }
 }
 
-void Logger::Error(const std::string& message) {
-    Log("[ERROR] " + message);
+void Logger::WriterLoop() {
+    while (g_running.load()) {
+        {
+            std::lock_guard<std::timed_mutex> lock(g_fileMutex);
+            DrainLocked();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
 }
@@ -0,0 +1,118 @@
+#include "NativeStats.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+NativeStats::Site NativeStats::m_sites[MaxSites] = {};
+NativeStats::Scope NativeStats::m_scopes[MaxScopes] = { { "Other", -1 } };
+uint64_t NativeStats::m_scopeCalls[MaxScopes][MaxSites] = {};
+int NativeStats::m_siteCount = 0;
+int NativeStats::m_scopeCount = 1; // Scope 0 collects calls made outside any scope
+int NativeStats::m_currentScope = 0;
+uint64_t NativeStats::m_frames = 0;
+
+int NativeStats::RegisterSite(const char* callText, const char* file, int line) {
+    if (m_siteCount >= MaxSites) return MaxSites - 1;
+
+    // Keep "NAMESPACE::NATIVE" and drop the arguments
+    const char* paren = std::strchr(callText, '(');
+    size_t length = paren ? (size_t)(paren - callText) : std::strlen(callText);
+
+    // Report paths relative to the source tree
+    const char* src = std::strstr(file, "src");
+    Site& site = m_sites[m_siteCount];
+    site.native.assign(callText, length);
+    site.file = src ? src : file;
+    site.line = line;
+    return m_siteCount++;
+}
+
+int NativeStats::EnterScope(const char* subsystem, int owner) {
+    int previous = m_currentScope;
+
+    for (int i = 1; i < m_scopeCount; i++) {
+        if (m_scopes[i].owner == owner && std::strcmp(m_scopes[i].subsystem, subsystem) == 0) {
+            m_currentScope = i;
+            return previous;
+        }
+    }
+
+    if (m_scopeCount < MaxScopes) {
+        m_scopes[m_scopeCount] = { subsystem, owner };
+        m_currentScope = m_scopeCount++;
+    } else {
+        m_currentScope = 0; // Table full, fold into "Other" until the next Reset
+    }
+    return previous;
+}
+
+bool NativeStats::Count(int site) {
+    m_scopeCalls[m_currentScope][site]++;
+    return (m_sites[site].calls++ % SampleRate) == 0;
+}
+
+void NativeStats::AddSample(int site, uint64_t ticks) {
+    m_sites[site].sampledTicks += ticks;
+    m_sites[site].samples++;
+}
+
+void NativeStats::Reset() {
+    for (int i = 0; i < m_siteCount; i++) {
+        m_sites[i].calls = 0;
+        m_sites[i].sampledTicks = 0;
+        m_sites[i].samples = 0;
+    }
+    std::memset(m_scopeCalls, 0, sizeof(m_scopeCalls));
+    m_scopeCount = 1;
+    m_currentScope = 0;
+    m_frames = 0;
+}
+
+bool NativeStats::WriteReport(const std::string& path) {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) return false;
+
+    double frames = m_frames > 0 ? (double)m_frames : 1.0;
+    std::vector<double> usPerCall(m_siteCount, 0.0);
+    for (int i = 0; i < m_siteCount; i++) {
+        if (m_sites[i].samples > 0) {
+            usPerCall[i] = Profiler::TicksToMicroseconds(m_sites[i].sampledTicks) / (double)m_sites[i].samples;
+        }
+    }
+
+    auto writeRows = [&](const uint64_t* calls, int limit) {
+        std::vector<int> order;
+        for (int i = 0; i < m_siteCount; i++) {
+            if (calls[i] > 0) order.push_back(i);
+        }
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            return calls[a] * usPerCall[a] > calls[b] * usPerCall[b];
+        });
+
+        char row[256];
+        for (int k = 0; k < (int)order.size() && k < limit; k++) {
+            int i = order[k];
+            snprintf(row, sizeof(row), "  %10.1f %12.1f %10.3f  %-48s %s:%d\n",
+                calls[i] / frames, calls[i] * usPerCall[i] / frames, usPerCall[i],
+                m_sites[i].native.c_str(), m_sites[i].file, m_sites[i].line);
+            file << row;
+        }
+    };
+
+    file << "Native calls over " << m_frames << " frames (1 in " << SampleRate << " calls timed)\n";
+    file << "  calls/frame  est us/frame  us/call  native                                           site\n";
+
+    std::vector<uint64_t> totals(MaxSites, 0);
+    for (int i = 0; i < m_siteCount; i++) totals[i] = m_sites[i].calls;
+    file << "\n== All ==\n";
+    writeRows(totals.data(), m_siteCount);
+
+    for (int s = 0; s < m_scopeCount; s++) {
+        file << "\n== " << m_scopes[s].subsystem;
+        if (m_scopes[s].owner >= 0) file << " [" << m_scopes[s].owner << "]";
+        file << " ==\n";
+        writeRows(m_scopeCalls[s], 10);
+    }
+    return true;
+}
@@ -0,0 +1,118 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <chrono>
+#endif
+
+const char* Profiler::m_names[MaxZones] = {};
+uint64_t Profiler::m_frameTicks[MaxZones] = {};
+int Profiler::m_frameCalls[MaxZones] = {};
+float Profiler::m_historyUs[MaxZones][WindowSize] = {};
+int Profiler::m_historyCalls[MaxZones][WindowSize] = {};
+int Profiler::m_zoneCount = 0;
+int Profiler::m_frameIndex = 0;
+int Profiler::m_framesRecorded = 0;
+
+int Profiler::RegisterZone(const char* name) {
+    // The same name from two call sites shares one zone
+    for (int i = 0; i < m_zoneCount; i++) {
+        if (std::strcmp(m_names[i], name) == 0) return i;
+    }
+    if (m_zoneCount >= MaxZones) return MaxZones - 1;
+
+    m_names[m_zoneCount] = name;
+    return m_zoneCount++;
+}
+
+void Profiler::Record(int zone, uint64_t ticks) {
+    m_frameTicks[zone] += ticks;
+    m_frameCalls[zone]++;
+}
+
+void Profiler::EndFrame() {
+    for (int i = 0; i < m_zoneCount; i++) {
+        m_historyUs[i][m_frameIndex] = (float)TicksToMicroseconds(m_frameTicks[i]);
+        m_historyCalls[i][m_frameIndex] = m_frameCalls[i];
+        m_frameTicks[i] = 0;
+        m_frameCalls[i] = 0;
+    }
+    m_frameIndex = (m_frameIndex + 1) % WindowSize;
+    if (m_framesRecorded < WindowSize) m_framesRecorded++;
+}
+
+uint64_t Profiler::Now() {
+#ifdef _WIN32
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)counter.QuadPart;
+#else
+    return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+double Profiler::TicksToMicroseconds(uint64_t ticks) {
+#ifdef _WIN32
+    static const double ticksPerUs = []() {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        return (double)frequency.QuadPart / 1.0e6;
+    }();
+    return (double)ticks / ticksPerUs;
+#else
+    using Period = std::chrono::steady_clock::period;
+    return (double)ticks * 1.0e6 * Period::num / Period::den;
+#endif
+}
+
+Profiler::ZoneStats Profiler::GetStats(int zone) {
+    ZoneStats stats = { m_names[zone], m_framesRecorded, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    if (m_framesRecorded == 0) return stats;
+
+    float sorted[WindowSize];
+    int totalCalls = 0;
+    double sum = 0.0;
+    for (int i = 0; i < m_framesRecorded; i++) {
+        sorted[i] = m_historyUs[zone][i];
+        sum += sorted[i];
+        totalCalls += m_historyCalls[zone][i];
+    }
+    std::sort(sorted, sorted + m_framesRecorded);
+
+    int p99Index = (std::min)(m_framesRecorded - 1, (m_framesRecorded * 99) / 100);
+    stats.callsPerFrame = (float)totalCalls / m_framesRecorded;
+    stats.minUs = sorted[0];
+    stats.avgUs = (float)(sum / m_framesRecorded);
+    stats.p99Us = sorted[p99Index];
+    stats.maxUs = sorted[m_framesRecorded - 1];
+    return stats;
+}
+
+bool Profiler::WriteCsv(const std::string& path) {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) return false;
+
+    file << "zone,frames,calls_per_frame,min_us,avg_us,p99_us,max_us\n";
+    for (int i = 0; i < m_zoneCount; i++) {
+        ZoneStats s = GetStats(i);
+        file << s.name << "," << s.samples << "," << s.callsPerFrame << "," << s.minUs << ","
+             << s.avgUs << "," << s.p99Us << "," << s.maxUs << "\n";
+    }
+
+    // Raw window, oldest frame first, one column per zone
+    file << "\nframe";
+    for (int i = 0; i < m_zoneCount; i++) file << "," << m_names[i];
+    file << "\n";
+    int first = m_framesRecorded < WindowSize ? 0 : m_frameIndex;
+    for (int f = 0; f < m_framesRecorded; f++) {
+        int slot = (first + f) % WindowSize;
+        file << f;
+        for (int i = 0; i < m_zoneCount; i++) file << "," << m_historyUs[i][slot];
+        file << "\n";
+    }
+    return true;
+}
@@ -3,15 +3,76 @@
 #include <iostream>
 #include <fstream>
 #include <filesystem>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <windows.h>
 #include "resource.h"
 #include "IniHelper.h" // For ShowNotification
 #include "Logger.h"
+#include "ConfigWatcher.h"
 
 namespace fs = std::filesystem;
 
 std::string XmlHelper::XmlPath = "";
 
+namespace {
+
+const long long SAVE_DELAY_MS = 750; // Quiet time after the last write before saving
+
+// Resident copy of menu_config.xml; only touched from the script thread
+std::shared_ptr<tinyxml2::XMLDocument> g_doc = std::make_shared<tinyxml2::XMLDocument>();
+std::unordered_map<std::string, tinyxml2::XMLElement*> g_index;
+bool g_dirty = false;
+std::chrono::steady_clock::time_point g_lastChange;
+
+// Background saver: the script thread hands over serialized text, newest wins.
+// g_saveMutex only guards the handoff and is never held across disk I/O, so
+// Update() can't stall the frame behind a slow write; g_fileMutex orders the
+// writes themselves. Both are timed so Shutdown can give up on them.
+std::thread g_saver;
+std::timed_mutex g_saveMutex;
+std::condition_variable_any g_saveCv;
+std::string g_pendingText;
+unsigned long long g_pendingSeq = 0; // Bumped on every handoff
+bool g_hasPending = false;
+bool g_saverRunning = false;
+
+std::timed_mutex g_fileMutex;
+unsigned long long g_writtenSeq = 0;
+
+const std::chrono::milliseconds SHUTDOWN_LOCK_TIMEOUT(250);
+
+// Skips text older than what is already on disk, e.g. a save Shutdown overtook
+void WriteIfNewer(const std::string& text, unsigned long long seq) {
+    if (seq <= g_writtenSeq) return;
+    XmlHelper::WriteFile(text);
+    g_writtenSeq = seq;
+}
+
+void SaverLoop() {
+    std::unique_lock<std::timed_mutex> lock(g_saveMutex);
+    while (g_saverRunning) {
+        g_saveCv.wait(lock, []() { return g_hasPending || !g_saverRunning; });
+        if (!g_hasPending) continue;
+
+        std::string text = std::move(g_pendingText);
+        unsigned long long seq = g_pendingSeq;
+        g_hasPending = false;
+
+        lock.unlock();
+        {
+            std::lock_guard<std::timed_mutex> fileLock(g_fileMutex);
+            WriteIfNewer(text, seq);
+        }
+        lock.lock();
+    }
+}
+
+} // namespace
+
 void XmlHelper::Initialize(HMODULE hModule) {
     // Use LOCALAPPDATA for TornadoVStuff
     char* localappdata = getenv("LOCALAPPDATA");
@@ -24,8 +85,126 @@ void XmlHelper::Initialize(HMODULE hModule) {
         DeployDefaultConfig(hModule);
     }
     
+    Reload();
+
     // Validate and repair XML configuration
     ValidateAndRepairXml();
+
+    if (!g_saverRunning) {
+        g_saverRunning = true;
+        g_saver = std::thread(SaverLoop);
+    }
+}
+
+void XmlHelper::Reload() {
+    g_doc->LoadFile(XmlPath.c_str());
+    g_index.clear();
+    g_dirty = false;
+}
+
+void XmlHelper::Adopt(std::shared_ptr<tinyxml2::XMLDocument> doc) {
+    g_doc = std::move(doc);
+    g_index.clear();
+    g_dirty = false;
+}
+
+void XmlHelper::Update() {
+    if (!g_dirty) return;
+
+    // Coalesce bursts (e.g. holding a colour slider) into one save once input settles
+    auto now = std::chrono::steady_clock::now();
+    if (std::chrono::duration_cast<std::chrono::milliseconds>(now - g_lastChange).count() < SAVE_DELAY_MS) return;
+    g_dirty = false;
+
+    std::string text = g_doc->ToString();
+    {
+        std::lock_guard<std::timed_mutex> lock(g_saveMutex);
+        g_pendingText = std::move(text);
+        g_pendingSeq++;
+        g_hasPending = true;
+    }
+    g_saveCv.notify_one();
+}
+
+void XmlHelper::Shutdown() {
+    // From DLL_PROCESS_DETACH the saver may already have been terminated while
+    // holding a lock. Wait briefly, then carry on without it rather than hang.
+    std::unique_lock<std::timed_mutex> lock(g_saveMutex, SHUTDOWN_LOCK_TIMEOUT);
+    if (g_dirty) {
+        g_pendingText = g_doc->ToString();
+        g_pendingSeq++;
+        g_hasPending = true;
+        g_dirty = false;
+    }
+    std::string text = std::move(g_pendingText);
+    unsigned long long seq = g_pendingSeq;
+    bool write = g_hasPending;
+    g_hasPending = false;
+
+    // Like the logger, don't join from DllMain; the saver exits once woken
+    g_saverRunning = false;
+    if (lock.owns_lock()) lock.unlock();
+    g_saveCv.notify_one();
+    if (g_saver.joinable()) {
+        g_saver.detach();
+    }
+
+    if (write) {
+        std::unique_lock<std::timed_mutex> fileLock(g_fileMutex, SHUTDOWN_LOCK_TIMEOUT);
+        WriteIfNewer(text, seq);
+    }
+}
+
+bool XmlHelper::WriteFile(const std::string& text) {
+    ConfigWatcher::NoteContent(ConfigFile::Xml, text);
+
+    std::string tempPath = XmlPath + ".tmp";
+    {
+        std::ofstream outFile(tempPath, std::ios::binary | std::ios::trunc);
+        if (!outFile.is_open()) return false;
+        outFile.write(text.data(), (std::streamsize)text.size());
+        if (!outFile.good()) return false;
+    }
+
+    std::error_code ec;
+    fs::rename(tempPath, XmlPath, ec);
+    if (ec) {
+        fs::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+void XmlHelper::MarkDirty() {
+    g_dirty = true;
+    g_lastChange = std::chrono::steady_clock::now();
+}
+
+tinyxml2::XMLElement* XmlHelper::Resolve(const std::string& path, bool create) {
+    auto it = g_index.find(path);
+    if (it != g_index.end()) return it->second;
+
+    tinyxml2::XMLElement* element = g_doc->RootElement();
+    if (!element) return nullptr;
+
+    // Split path by dot: MenuConfig.Frame.TitleBox
+    std::stringstream ss(path);
+    std::string segment;
+    std::getline(ss, segment, '.'); // Skip root if it matches
+    if (element->NameView() != segment) return nullptr;
+
+    while (std::getline(ss, segment, '.')) {
+        tinyxml2::XMLElement* next = element->FirstChildElement(segment.c_str());
+        if (!next) {
+            if (!create) return nullptr;
+            next = element->InsertNewChild(segment.c_str());
+        }
+        element = next;
+    }
+
+    // Elements live until the next Reload, which clears the index
+    g_index.emplace(path, element);
+    return element;
 }
 
 void XmlHelper::DeployDefaultConfig(HMODULE hModule) {
@@ -50,26 +229,10 @@ void XmlHelper::DeployDefaultConfig(HMODULE hModule) {
     }
 }
 
-// Since we don't have tinyxml2 yet, these are stubs for now.
-// I will implement the real logic once I've added tinyxml2 to the project.
 std::string XmlHelper::GetString(const std::string& path, const std::string& defaultValue) {
-    tinyxml2::XMLDocument doc;
-    doc.LoadFile(XmlPath.c_str());
-    
-    tinyxml2::XMLElement* element = doc.RootElement();
+    tinyxml2::XMLElement* element = Resolve(path, false);
     if (!element) return defaultValue;
 
-    // Split path by dot: MenuConfig.Frame.TitleBox
-    std::stringstream ss(path);
-    std::string segment;
-    std::getline(ss, segment, '.'); // Skip root if it matches
-    if (element->name != segment) return defaultValue;
-
-    while (std::getline(ss, segment, '.')) {
-        element = element->FirstChildElement(segment.c_str());
-        if (!element) return defaultValue;
-    }
-
     const char* val = element->Attribute("value");
     return val ? val : defaultValue;
 }
@@ -93,22 +256,9 @@ bool XmlHelper::GetBool(const std::string& path, bool defaultValue) {
 }
 
 XmlHelper::Color XmlHelper::GetColor(const std::string& path, XmlHelper::Color defaultValue) {
-    tinyxml2::XMLDocument doc;
-    doc.LoadFile(XmlPath.c_str());
-    
-    tinyxml2::XMLElement* element = doc.RootElement();
+    tinyxml2::XMLElement* element = Resolve(path, false);
     if (!element) return defaultValue;
 
-    std::stringstream ss(path);
-    std::string segment;
-    std::getline(ss, segment, '.'); // Skip root if it matches
-    if (element->name != segment) return defaultValue;
-
-    while (std::getline(ss, segment, '.')) {
-        element = element->FirstChildElement(segment.c_str());
-        if (!element) return defaultValue;
-    }
-
     XmlHelper::Color result = defaultValue;
     if (element->Attribute("r")) result.r = std::stoi(element->Attribute("r"));
     if (element->Attribute("g")) result.g = std::stoi(element->Attribute("g"));
@@ -119,75 +269,43 @@ XmlHelper::Color XmlHelper::GetColor(const std::string& path, XmlHelper::Color d
 }
 
 void XmlHelper::WriteValue(const std::string& path, const std::string& value) {
-    tinyxml2::XMLDocument doc;
-    doc.LoadFile(XmlPath.c_str());
-    
-    tinyxml2::XMLElement* element = doc.RootElement();
+    tinyxml2::XMLElement* element = Resolve(path, true);
     if (!element) return;
 
-    std::stringstream ss(path);
-    std::string segment;
-    std::getline(ss, segment, '.'); // Skip root if it matches
-    if (element->name != segment) return;
-
-    while (std::getline(ss, segment, '.')) {
-        tinyxml2::XMLElement* next = element->FirstChildElement(segment.c_str());
-        if (!next) {
-            next = element->InsertNewChild(segment.c_str());
-        }
-        element = next;
-    }
-
-    element->attributes["value"] = value;
-    doc.SaveFile(XmlPath.c_str());
+    const char* current = element->Attribute("value");
+    if (current && value == current) return;
+    element->SetAttribute("value", value.c_str());
+    MarkDirty();
 }
 
 void XmlHelper::WriteColor(const std::string& path, XmlHelper::Color value) {
-    tinyxml2::XMLDocument doc;
-    doc.LoadFile(XmlPath.c_str());
-    
-    tinyxml2::XMLElement* element = doc.RootElement();
+    tinyxml2::XMLElement* element = Resolve(path, true);
     if (!element) return;
 
-    std::stringstream ss(path);
-    std::string segment;
-    std::getline(ss, segment, '.'); // Skip root if it matches
-    if (element->name != segment) return;
-
-    while (std::getline(ss, segment, '.')) {
-        tinyxml2::XMLElement* next = element->FirstChildElement(segment.c_str());
-        if (!next) {
-            next = element->InsertNewChild(segment.c_str());
-        }
-        element = next;
-    }
-
-    element->attributes["r"] = std::to_string(value.r);
-    element->attributes["g"] = std::to_string(value.g);
-    element->attributes["b"] = std::to_string(value.b);
-    element->attributes["a"] = std::to_string(value.a);
-    
-    doc.SaveFile(XmlPath.c_str());
+    element->SetAttribute("r", value.r);
+    element->SetAttribute("g", value.g);
+    element->SetAttribute("b", value.b);
+    element->SetAttribute("a", value.a);
+    MarkDirty();
 }
 
 void XmlHelper::ValidateAndRepairXml() {
     Logger::Log("XML validation started...");
     
-    tinyxml2::XMLDocument doc;
-    doc.LoadFile(XmlPath.c_str());
-    
-    if (!doc.RootElement()) {
+    if (!g_doc->RootElement()) {
         Logger::Log("XML file corrupted or invalid, deploying default...");
         DeployDefaultConfig(NULL);
+        Reload();
         return;
     }
     
     bool repairsMade = false;
-    tinyxml2::XMLElement* root = doc.RootElement();
+    tinyxml2::XMLElement* root = g_doc->RootElement();
     
     if (!root || std::string(root->Name()) != "MenuConfig") {
         Logger::Log("Invalid XML root element, deploying default...");
         DeployDefaultConfig(NULL);
+        Reload();
         return;
     }
     
@@ -286,7 +404,7 @@ void XmlHelper::ValidateAndRepairXml() {
         if (current) {
             // Check if attribute exists
             if (!current->Attribute(element.attribute)) {
-                current->attributes[element.attribute] = element.defaultValue;
+                current->SetAttribute(element.attribute, element.defaultValue);
                 Logger::Log("Added missing XML attribute: " + path + " " + element.attribute + " = " + element.defaultValue);
                 repairsMade = true;
             }
@@ -294,7 +412,8 @@ void XmlHelper::ValidateAndRepairXml() {
     }
     
     if (repairsMade) {
-        doc.SaveFile(XmlPath.c_str());
+        // Written straight away rather than debounced; this only happens at startup
+        WriteFile(g_doc->ToString());
         Logger::Log("XML file repaired successfully!");
     } else {
         Logger::Log("XML file validation passed - no repairs needed");